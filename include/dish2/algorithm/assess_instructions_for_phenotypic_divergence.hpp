@@ -30,6 +30,7 @@ size_t assess_instructions_for_phenotypic_divergence(
     idx < std::min(inst_idx + nop_length, nopout.program.size());
     ++idx
   ) nopout.program[ idx ].NopOut();
+  nopout.RefreshCodingGenotypeHash();
 
   return dish2::run_until_phenotypic_divergence<Spec>( genome, nopout );
 
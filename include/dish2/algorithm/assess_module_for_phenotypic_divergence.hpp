@@ -29,6 +29,7 @@ size_t assess_module_for_phenotypic_divergence(
   nopout.program = sgpl::nop_out_module<sgpl_spec_t>(
     nopout.program, module_idx
   );
+  nopout.RefreshCodingGenotypeHash();
 
   return dish2::run_until_phenotypic_divergence<Spec>( genome, nopout );
 
@@ -57,6 +57,7 @@ auto nop_out_phenotypically_neutral_modules(
 
   genome.program
     = sgpl::nop_out_modules< sgpl_spec_t >( genome.program, should_nop );
+  genome.RefreshCodingGenotypeHash();
 
   return std::tuple{genome, divergence_updates};
 
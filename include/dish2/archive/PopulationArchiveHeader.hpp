@@ -0,0 +1,52 @@
+#pragma once
+#ifndef DISH2_ARCHIVE_POPULATIONARCHIVEHEADER_HPP_INCLUDE
+#define DISH2_ARCHIVE_POPULATIONARCHIVEHEADER_HPP_INCLUDE
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace dish2 {
+
+/// Fixed-size leading bytes of a population archive.
+/// Fields are in native byte order.
+struct PopulationArchiveHeader {
+
+  static constexpr char expected_magic[8] = "DISH2PA";
+  static constexpr uint32_t expected_version = 1;
+
+  char magic[8];
+  uint32_t version{ expected_version };
+  // nonzero if genome blocks are deflate-compressed
+  uint32_t compressed{};
+  uint64_t num_genomes{};
+  // byte offset of the index, an array of PopulationArchiveIndexEntry
+  uint64_t index_offset{};
+
+  PopulationArchiveHeader() {
+    std::memcpy( magic, expected_magic, sizeof( magic ) );
+  }
+
+  bool IsValid() const {
+    return std::memcmp( magic, expected_magic, sizeof( magic ) ) == 0
+      && version == expected_version;
+  }
+
+};
+
+/// Location and summary of one genome block within a population archive.
+struct PopulationArchiveIndexEntry {
+
+  uint64_t offset;
+  uint64_t stored_size;
+  uint64_t raw_size;
+  uint64_t root_id;
+
+};
+
+static_assert( std::is_trivially_copyable_v< PopulationArchiveHeader > );
+static_assert( std::is_trivially_copyable_v< PopulationArchiveIndexEntry > );
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_ARCHIVE_POPULATIONARCHIVEHEADER_HPP_INCLUDE
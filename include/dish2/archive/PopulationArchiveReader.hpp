@@ -0,0 +1,132 @@
+#pragma once
+#ifndef DISH2_ARCHIVE_POPULATIONARCHIVEREADER_HPP_INCLUDE
+#define DISH2_ARCHIVE_POPULATIONARCHIVEREADER_HPP_INCLUDE
+
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <zlib.h>
+
+#include "../../../third-party/cereal/include/cereal/archives/binary.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../genome/Genome.hpp"
+
+#include "PopulationArchiveHeader.hpp"
+
+namespace dish2 {
+
+/// Read-only, memory-mapped view of a population archive.
+/// Genomes are decoded lazily, one at a time, on request.
+template< typename Spec >
+class PopulationArchiveReader {
+
+  const char* data{ nullptr };
+  size_t size{};
+  dish2::PopulationArchiveHeader header;
+  const dish2::PopulationArchiveIndexEntry* index{ nullptr };
+
+public:
+
+  explicit PopulationArchiveReader( const std::string& path ) {
+
+    const int fd = open( path.c_str(), O_RDONLY );
+    emp_always_assert( fd != -1, path );
+
+    struct stat st;
+    emp_always_assert( fstat( fd, &st ) == 0, path );
+    size = st.st_size;
+    emp_always_assert( size >= sizeof( header ), path, size );
+
+    void* mapping = mmap( nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    emp_always_assert( mapping != MAP_FAILED, path );
+    data = static_cast<const char*>( mapping );
+
+    std::memcpy( &header, data, sizeof( header ) );
+    emp_always_assert( header.IsValid(), path );
+    emp_always_assert(
+      header.index_offset
+        + header.num_genomes * sizeof( dish2::PopulationArchiveIndexEntry )
+      <= size,
+      path, header.index_offset, header.num_genomes, size
+    );
+
+    // writer pads the index so it can be read in place
+    emp_always_assert(
+      header.index_offset % alignof( dish2::PopulationArchiveIndexEntry ) == 0,
+      header.index_offset
+    );
+    index = reinterpret_cast<const dish2::PopulationArchiveIndexEntry*>(
+      data + header.index_offset
+    );
+
+  }
+
+  ~PopulationArchiveReader() {
+    if ( data ) munmap( const_cast<char*>( data ), size );
+  }
+
+  PopulationArchiveReader( const PopulationArchiveReader& ) = delete;
+  PopulationArchiveReader& operator=( const PopulationArchiveReader& )
+    = delete;
+
+  size_t GetNumGenomes() const { return header.num_genomes; }
+
+  bool IsCompressed() const { return header.compressed; }
+
+  /// Root ID of genome k, available without decoding the genome.
+  size_t GetRootID( const size_t k ) const {
+    emp_assert( k < GetNumGenomes() );
+    return index[k].root_id;
+  }
+
+  dish2::Genome<Spec> GetGenome( const size_t k ) const {
+    emp_assert( k < GetNumGenomes() );
+
+    const auto& entry = index[k];
+    emp_always_assert(
+      entry.offset + entry.stored_size <= header.index_offset,
+      k, entry.offset, entry.stored_size
+    );
+
+    std::string raw;
+    if ( header.compressed ) {
+      raw.resize( entry.raw_size );
+      uLongf raw_size = entry.raw_size;
+      emp_always_assert( uncompress(
+        reinterpret_cast<Bytef*>( raw.data() ), &raw_size,
+        reinterpret_cast<const Bytef*>( data + entry.offset ),
+        entry.stored_size
+      ) == Z_OK, k );
+      emp_always_assert( raw_size == entry.raw_size, raw_size, k );
+    } else raw.assign( data + entry.offset, entry.stored_size );
+
+    std::istringstream ss( std::move( raw ) );
+    cereal::BinaryInputArchive archive( ss );
+    dish2::Genome<Spec> genome;
+    archive( genome );
+    return genome;
+  }
+
+  emp::vector< dish2::Genome<Spec> > GetGenomes() const {
+    emp::vector< dish2::Genome<Spec> > res;
+    res.reserve( GetNumGenomes() );
+    for ( size_t k{}; k < GetNumGenomes(); ++k ) {
+      res.push_back( GetGenome( k ) );
+    }
+    return res;
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_ARCHIVE_POPULATIONARCHIVEREADER_HPP_INCLUDE
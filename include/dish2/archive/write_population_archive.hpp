@@ -0,0 +1,95 @@
+#pragma once
+#ifndef DISH2_ARCHIVE_WRITE_POPULATION_ARCHIVE_HPP_INCLUDE
+#define DISH2_ARCHIVE_WRITE_POPULATION_ARCHIVE_HPP_INCLUDE
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <zlib.h>
+
+#include "../../../third-party/cereal/include/cereal/archives/binary.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../genome/Genome.hpp"
+
+#include "PopulationArchiveHeader.hpp"
+
+namespace dish2 {
+
+/// Write genomes to path as an indexed population archive.
+/// @param level deflate level for each genome block, or 0 for uncompressed.
+template< typename Spec >
+void write_population_archive(
+  const std::string& path,
+  const emp::vector< dish2::Genome<Spec> >& genomes,
+  const int level
+) {
+
+  std::ofstream os( path, std::ios::binary );
+  emp_always_assert( os, path );
+
+  dish2::PopulationArchiveHeader header;
+  header.compressed = level > 0;
+  header.num_genomes = genomes.size();
+  // placeholder, rewritten once index offset is known
+  os.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+
+  emp::vector< dish2::PopulationArchiveIndexEntry > index;
+  index.reserve( genomes.size() );
+
+  std::string raw;
+  std::string compressed;
+  for ( const auto& genome : genomes ) {
+
+    std::ostringstream ss;
+    {
+      cereal::BinaryOutputArchive archive( ss );
+      archive( genome );
+    }
+    raw = ss.str();
+
+    const std::string* block = &raw;
+    if ( header.compressed ) {
+      uLongf compressed_size = compressBound( raw.size() );
+      compressed.resize( compressed_size );
+      emp_always_assert( compress2(
+        reinterpret_cast<Bytef*>( compressed.data() ), &compressed_size,
+        reinterpret_cast<const Bytef*>( raw.data() ), raw.size(),
+        level
+      ) == Z_OK );
+      compressed.resize( compressed_size );
+      block = &compressed;
+    }
+
+    index.push_back( {
+      static_cast<uint64_t>( os.tellp() ),
+      block->size(),
+      raw.size(),
+      genome.root_id.GetID()
+    } );
+    os.write( block->data(), block->size() );
+
+  }
+
+  // pad so index entries can be read in place from a memory mapping
+  while ( os.tellp() % alignof( dish2::PopulationArchiveIndexEntry ) ) {
+    os.put( '\0' );
+  }
+  header.index_offset = os.tellp();
+  os.write(
+    reinterpret_cast<const char*>( index.data() ),
+    index.size() * sizeof( dish2::PopulationArchiveIndexEntry )
+  );
+
+  os.seekp( 0 );
+  os.write( reinterpret_cast<const char*>( &header ), sizeof( header ) );
+
+  emp_always_assert( os, path );
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_ARCHIVE_WRITE_POPULATION_ARCHIVE_HPP_INCLUDE
@@ -8,6 +8,8 @@
 
 #include "../../debug/LogScope.hpp"
 #include "../../enum/CauseOfDeath.hpp"
+#include "../../phylogeny/PhylogenyTracker.hpp"
+#include "../../phylogeny/RootAbundanceTable.hpp"
 
 #include "../cardinal_iterators/EpochWrapper.hpp"
 #include "../cardinal_iterators/IsAliveWrapper.hpp"
@@ -38,6 +40,11 @@ void Cell<Spec>::DeathRoutine(
     end<dish2::EpochWrapper<Spec>>()
   ).size() == 1 ));
 
+  if ( genome ) {
+    dish2::PhylogenyTracker::Get().RecordDeath( genome->taxon_id );
+    dish2::RootAbundanceTable::Get().RecordDeath( *this );
+  }
+
   HeirPayoutRoutine();
 
   const auto epoch = *begin<dish2::EpochWrapper<Spec>>();
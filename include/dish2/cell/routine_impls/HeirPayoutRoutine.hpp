@@ -15,6 +15,7 @@
 #include "../cardinal_iterators/ResourceNodeOutputWrapper.hpp"
 #include "../cardinal_iterators/ResourceStockpileWrapper.hpp"
 #include "../../debug/LogScope.hpp"
+#include "../../debug/tally_put.hpp"
 
 namespace dish2 {
 
@@ -49,7 +50,7 @@ void Cell<Spec>::HeirPayoutRoutine() {
     end<dish2::HeirRequestWrapper<Spec>>(),
     begin<dish2::ResourceNodeOutputWrapper<Spec>>(),
     [amt_per_heir](const auto is_heir, auto& output) {
-      if (is_heir) output.TryPut( amt_per_heir );
+      if (is_heir) dish2::tally_put( output, amt_per_heir );
     }
   );
 
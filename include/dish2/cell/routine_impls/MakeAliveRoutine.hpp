@@ -11,6 +11,7 @@
 #include "../cardinal_iterators/KinGroupAgeWrapper.hpp"
 #include "../cardinal_iterators/KinGroupIDViewWrapper.hpp"
 #include "../../debug/LogScope.hpp"
+#include "../../phylogeny/RootAbundanceTable.hpp"
 
 namespace dish2 {
 
@@ -87,6 +88,8 @@ void Cell<Spec>::MakeAliveRoutine() {
     [this](auto& cpu){ cpu.InitializeAnchors( genome->program ); }
   );
 
+  dish2::RootAbundanceTable::Get().RecordBirth( *this );
+
 
 }
 
@@ -50,6 +50,21 @@ EMP_BUILD_CONFIG(
   VALUE(THROW_ON_EXTINCTION, bool, true,
     "[NATIVE] Should we throw an exception if populations go extinct?"
   ),
+  VALUE(NODE_LOCAL_ASSIGN, bool, true,
+    "[NATIVE] Should perfect hypercube assignments place adjacent blocks on processes that share a node? Has no effect on single-node runs."
+  ),
+  VALUE(SHARED_WINDOW_DUCT_SLOTS, size_t, 4096,
+    "[NATIVE] How many incoming same-node state and quorum ducts can each process hold in shared memory? If 0, same-node ducts use MPI messaging."
+  ),
+  VALUE(GENOME_WIRE_COMPRESSION_LEVEL, int, 0,
+    "[NATIVE] What deflate level should genomes sent between processes be compressed at? If 0, send uncompressed. Deflate saves about a fifth of bytes, so is only worthwhile on slow links."
+  ),
+  VALUE(DUCT_ADAPTIVE_CAPACITY, bool, true,
+    "[NATIVE] Should same-node shared memory ducts grow or shrink their buffers based on observed drop rates?"
+  ),
+  VALUE(DUCT_ADAPTIVE_CAPACITY_MAX_FACTOR, size_t, 16,
+    "[NATIVE] Up to how many times their base capacity may adaptive same-node shared memory ducts grow? Shared memory is reserved for the largest capacity. Must agree across processes on a node."
+  ),
 
 
   GROUP(EXPERIMENT, "EXPERIMENT"),
@@ -63,7 +78,7 @@ EMP_BUILD_CONFIG(
   VALUE(REPLICATE, std::string, "", "TODO"),
   VALUE(
     GENESIS, std::string, "generate",
-    "generate, reconstitute, monoculture, or innoculate"
+    "generate, reconstitute, monoculture, innoculate, or checkpoint"
   ),
   // VALUE(SEED_POP, bool, 0, "Should we seed the population?"),
   // VALUE(SEED_POP_ID, size_t, 0, "Should we seed the population with all seedpop IDs (0) or with a specific ID (>0)?"),
@@ -174,6 +189,24 @@ EMP_BUILD_CONFIG(
   VALUE(CONDUIT_FLUSH_SERVICE_FREQUENCY, size_t, 16,
     "Run service every ?? updates."
   ),
+  VALUE(GENOME_CONDUIT_FLUSH_FREQUENCY, size_t, 0,
+    "Flush genome mesh every ?? updates. If 0, use CONDUIT_FLUSH_SERVICE_FREQUENCY."
+  ),
+  VALUE(MESSAGE_CONDUIT_FLUSH_FREQUENCY, size_t, 0,
+    "Flush message mesh every ?? updates. If 0, use CONDUIT_FLUSH_SERVICE_FREQUENCY."
+  ),
+  VALUE(QUORUM_CONDUIT_FLUSH_FREQUENCY, size_t, 0,
+    "Flush quorum mesh every ?? updates. If 0, use CONDUIT_FLUSH_SERVICE_FREQUENCY."
+  ),
+  VALUE(RESOURCE_CONDUIT_FLUSH_FREQUENCY, size_t, 0,
+    "Flush resource mesh every ?? updates. If 0, use CONDUIT_FLUSH_SERVICE_FREQUENCY."
+  ),
+  VALUE(STATE_CONDUIT_FLUSH_FREQUENCY, size_t, 0,
+    "Flush state mesh every ?? updates. If 0, use CONDUIT_FLUSH_SERVICE_FREQUENCY."
+  ),
+  VALUE(CONDUIT_FLUSH_ONLY_DIRTY, bool, false,
+    "Skip scheduled flushes of meshes that have had no puts on any thread or process since their last flush? Puts made during the update of a skipped flush wait for the next flush. With multiple threads or processes, requires RUN_SECONDS 0 and ASYNCHRONOUS 0."
+  ),
   VALUE(COLLECTIVE_HARVESTING_SERVICE_FREQUENCY, size_t, 16,
     "Run service every ?? updates."
   ),
@@ -246,9 +279,84 @@ EMP_BUILD_CONFIG(
   VALUE(DATA_DUMP, bool, false,
     "[NATIVE] Should we record data on the final state of the simulation?"
   ),
+  VALUE(DATA_COLUMNAR, bool, false,
+    "[NATIVE] Should cell census and metrics data be written in dictionary-encoded columnar binary format (.dcf) instead of csv?"
+  ),
+  VALUE(DATA_COLUMNAR_ROW_GROUP_SIZE, size_t, 65536,
+    "[NATIVE] How many rows should columnar data files buffer before compressing and writing them?"
+  ),
+  VALUE(DATA_COLUMNAR_LEVEL, int, 6,
+    "[NATIVE] What deflate level should columns in columnar data files be compressed with? 0 disables compression."
+  ),
+  VALUE(DATA_GLOBAL_METRICS, bool, false,
+    "[NATIVE] Should per-cell demographic phenotypic phylogenetic metrics also be reduced across all threads and processes and written to a single global metrics file by proc 0 thread 0? Metrics that can't be merged from per-thread sums are omitted. With multiple threads or processes, requires RUN_SECONDS 0."
+  ),
   VALUE(ARTIFACTS_DUMP, bool, false,
     "[NATIVE] Should we record data on the final state of the simulation?"
   ),
+  VALUE(ASYNC_DUMP, bool, true,
+    "[NATIVE] Should population, checkpoint, and running log dumps be compressed and written on a background thread?"
+  ),
+  VALUE(DATA_DUMP_PARALLEL, bool, true,
+    "[NATIVE] Should end-of-run data dumps run concurrently on separate threads?"
+  ),
+  VALUE(DUMP_COMPRESSION_THREADS, size_t, 4,
+    "[NATIVE] How many blocks may xz-compressed log dumps compress concurrently? Budget is shared by all dumps of all threads of a process."
+  ),
+  VALUE(EVENT_STREAM, bool, false,
+    "[NATIVE] Should every birth, death, and spawn event be streamed to disk over the course of the run? Records are not subject to RUNNING_LOG_DURATION."
+  ),
+  VALUE(EVENT_STREAM_FLUSH_BYTES, size_t, 1048576,
+    "[NATIVE] How many bytes of event records should each thread buffer before compressing and writing them? Up to three such chunks may be held in memory per thread while compression catches up."
+  ),
+  VALUE(GENOME_COMPRESSION_RATIO_SAMPLE_SIZE, size_t, 0,
+    "[NATIVE] How many evenly-spaced live cells should mean genome compression ratio be estimated from? 0 uses all live cells."
+  ),
+  VALUE(INTROSPECTION_THREADS, size_t, 1,
+    "[NATIVE] How many threads may each simulation thread use for expensive introspection queries when writing metrics? 0 uses hardware concurrency."
+  ),
+  VALUE(DISTINCT_COUNT_SKETCH_PRECISION, size_t, 0,
+    "[NATIVE] If nonzero, estimate unique genotype, phylogenetic root, and module profile counts with HyperLogLog sketches of 2^DISTINCT_COUNT_SKETCH_PRECISION registers instead of counting exactly. Must be between 4 and 18. Sketches are also merged into global metrics."
+  ),
+  VALUE(PHYLOGENY_TRACKING, bool, false,
+    "[NATIVE] Should we track a pruned genotype-level phylogeny over the course of the run and dump it with the data dump?"
+  ),
+  VALUE(PHYLOGENY_PRUNE_DELAY, size_t, 16,
+    "[NATIVE] How many updates after a taxon's last birth, death, or spawn send should it become eligible for pruning? Must cover spawn transit time."
+  ),
+  VALUE(CHECKPOINT_DUMP, bool, false,
+    "[NATIVE] Should we record a checkpoint of complete simulation state at the end of the simulation? Restore with GENESIS checkpoint."
+  ),
+  VALUE(POPULATION_CODEC, std::string, "xz",
+    "[NATIVE] How should population dumps and snapshots be compressed? none, gz, or xz."
+  ),
+  VALUE(POPULATION_CODEC_LEVEL, int, 9,
+    "[NATIVE] What compression level should population dumps and snapshots use?"
+  ),
+  VALUE(POPULATION_ARCHIVE, bool, false,
+    "[NATIVE] Should population dumps and snapshots be written as indexed archives that support random access to individual genomes? If so, POPULATION_CODEC is ignored."
+  ),
+  VALUE(POPULATION_ARCHIVE_LEVEL, int, 1,
+    "[NATIVE] What deflate level should each genome in an indexed population archive be compressed with? 0 disables compression."
+  ),
+  VALUE(CHECKPOINT_CODEC, std::string, "gz",
+    "[NATIVE] How should checkpoints be compressed? none, gz, or xz."
+  ),
+  VALUE(CHECKPOINT_CODEC_LEVEL, int, 1,
+    "[NATIVE] What compression level should checkpoints use?"
+  ),
+  VALUE(SNAPSHOT_FREQUENCY, size_t, 0,
+    "[NATIVE] How many updates should elapse between mid-run snapshots? If 0, never snapshot by update. Must be power of two."
+  ),
+  VALUE(SNAPSHOT_SECONDS, double, 0,
+    "[NATIVE] How many seconds should elapse between mid-run snapshots? If 0, never snapshot by time."
+  ),
+  VALUE(SNAPSHOT_POPULATION, bool, true,
+    "[NATIVE] Should mid-run snapshots include the population?"
+  ),
+  VALUE(SNAPSHOT_CHECKPOINT, bool, false,
+    "[NATIVE] Should mid-run snapshots include a checkpoint?"
+  ),
   VALUE(BENCHMARKING_DUMP, bool, false,
     "[NATIVE] Should we record data for benchmarking the simulation?"
   ),
@@ -256,7 +364,7 @@ EMP_BUILD_CONFIG(
     "[NATIVE] How many updates should elapse between recording phylogenetic root abundances? If 0, never record phylogenetic root abundances. Must be power of two."
   ),
   VALUE(ABORT_IF_COALESCENT_FREQ, size_t, 0,
-    "[NATIVE] How many updates should elapse between checking for coalescence? If 0, never check for coalescence. Must be power of two."
+    "[NATIVE] How many updates should elapse between checking for coalescence? If 0, never check for coalescence. Must be power of two. With multiple threads or processes, requires RUN_SECONDS 0."
   ),
   VALUE(REGULATION_VIZ_CLAMP, double, 10.0,
     "What bounds should we clamp regulation values into before running PCA visualization?"
@@ -272,10 +380,6 @@ EMP_BUILD_CONFIG(
   //   "[NATIVE] "
   //   "What should the compression level for the .h5 files be?"
   // ),
-  // VALUE(SNAPSHOT_FREQUENCY, size_t, 0,
-  //   "[NATIVE] "
-  //   "How often should we save data snapshots?"
-  // ),
   // VALUE(SNAPSHOT_LENGTH, size_t, 16,
   //   "[NATIVE] "
   //   "How long should snapshots last for?"
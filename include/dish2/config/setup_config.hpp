@@ -6,8 +6,10 @@
 #include <iostream>
 
 #include "../../../third-party/conduit/include/uitsl/polyfill/filesystem.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
 #include "../../../third-party/Empirical/include/emp/config/ArgManager.hpp"
 
+#include "../utility/HyperLogLog.hpp"
 #include "../utility/path_exists.hpp"
 
 #include "cfg.hpp"
@@ -28,6 +30,16 @@ void setup_config( emp::ArgManager& arg_manager ) {
 
   if ( arg_manager.HasUnused() ) std::exit( EXIT_FAILURE );
 
+  const size_t sketch_precision = dish2::cfg.DISTINCT_COUNT_SKETCH_PRECISION();
+  emp_always_assert(
+    sketch_precision == 0 || (
+      sketch_precision >= dish2::HyperLogLog::min_precision
+      && sketch_precision <= dish2::HyperLogLog::max_precision
+    ),
+    "DISTINCT_COUNT_SKETCH_PRECISION must be 0 or between 4 and 18",
+    sketch_precision
+  );
+
 }
 
 } // namespace dish2
@@ -0,0 +1,57 @@
+#pragma once
+#ifndef DISH2_DEBUG_MESHPUTTALLY_HPP_INCLUDE
+#define DISH2_DEBUG_MESHPUTTALLY_HPP_INCLUDE
+
+#include <limits>
+#include <utility>
+
+namespace dish2 {
+
+/// Counts put attempts and drops on outputs of a mesh, per thread.
+template< typename MeshSpec >
+class MeshPutTally {
+
+  size_t num_attempts{};
+  size_t num_drops{};
+  bool dirty{};
+
+  MeshPutTally() = default;
+
+public:
+
+  static MeshPutTally& Get() {
+    thread_local MeshPutTally tally;
+    return tally;
+  }
+
+  /// @return success, for chaining.
+  bool Record( const bool success ) {
+    ++num_attempts;
+    num_drops += !success;
+    dirty = true;
+    return success;
+  }
+
+  /// Flag a put that isn't otherwise recorded.
+  void MarkDirty() { dirty = true; }
+
+  /// @return whether any puts have been made since last call.
+  bool TakeDirty() { return std::exchange( dirty, false ); }
+
+  size_t GetNumAttempts() const { return num_attempts; }
+
+  size_t GetNumDrops() const { return num_drops; }
+
+  double GetDropFraction() const {
+    return num_attempts
+      ? num_drops / static_cast<double>( num_attempts )
+      : std::numeric_limits<double>::quiet_NaN();
+  }
+
+  void Reset() { num_attempts = 0; num_drops = 0; }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_DEBUG_MESHPUTTALLY_HPP_INCLUDE
@@ -0,0 +1,20 @@
+#pragma once
+#ifndef DISH2_DEBUG_TALLY_PUT_HPP_INCLUDE
+#define DISH2_DEBUG_TALLY_PUT_HPP_INCLUDE
+
+#include "../../../third-party/conduit/include/netuit/mesh/MeshNodeOutput.hpp"
+
+#include "MeshPutTally.hpp"
+
+namespace dish2 {
+
+/// Try put on output, recording attempt and success in its mesh's tally.
+/// @return whether put succeeded.
+template< typename MeshSpec, typename T >
+bool tally_put( netuit::MeshNodeOutput< MeshSpec >& output, const T& val ) {
+  return dish2::MeshPutTally< MeshSpec >::Get().Record( output.TryPut( val ) );
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_DEBUG_TALLY_PUT_HPP_INCLUDE
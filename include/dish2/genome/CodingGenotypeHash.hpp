@@ -0,0 +1,98 @@
+#pragma once
+#ifndef DISH2_GENOME_CODINGGENOTYPEHASH_HPP_INCLUDE
+#define DISH2_GENOME_CODINGGENOTYPEHASH_HPP_INCLUDE
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../third-party/Empirical/include/emp/datastructs/hash_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+
+#include "../utility/murmur_hash_128.hpp"
+
+namespace dish2 {
+
+namespace internal::coding_genotype_hash {
+
+  // append tag bits as 32-bit words, which have no padding
+  template< typename Tag >
+  void append_tag( emp::vector< uint32_t >& words, const Tag& tag ) {
+    for ( size_t i{}; i * 32 < tag.GetSize(); ++i ) {
+      words.push_back( tag.GetUInt( i ) );
+    }
+  }
+
+  template< typename Words >
+  std::span< const std::byte > as_bytes( const Words& words ) {
+    return std::span< const std::byte >(
+      reinterpret_cast< const std::byte* >( words.data() ),
+      words.size() * sizeof( words.front() )
+    );
+  }
+
+} // namespace internal::coding_genotype_hash
+
+/// 128-bit hash of a genome's event tags and program, for counting coding
+/// genotypes without comparing whole programs.
+/// Instruction fields are hashed one by one, so padding bytes, which may
+/// differ between equal programs, don't affect the hash.
+struct CodingGenotypeHash {
+
+  uint64_t lo{};
+  uint64_t hi{};
+
+  CodingGenotypeHash() = default;
+
+  template< typename EventTags, typename Program >
+  CodingGenotypeHash( const EventTags& event_tags, const Program& program ) {
+    using namespace internal::coding_genotype_hash;
+
+    // reused between hashes to avoid reallocation
+    thread_local emp::vector< uint32_t > words;
+
+    words.clear();
+    for ( const auto& tag : event_tags.tags ) append_tag( words, tag );
+    const uint64_t seed = emp::murmur_hash( as_bytes( words ) );
+
+    words.clear();
+    for ( const auto& inst : program ) {
+      words.push_back( inst.op_code );
+      for ( const auto arg : inst.args ) words.push_back( arg );
+      append_tag( words, inst.tag );
+    }
+    std::tie( lo, hi ) = dish2::murmur_hash_128( as_bytes( words ), seed );
+  }
+
+  bool operator==( const CodingGenotypeHash& other ) const {
+    return std::tuple{ lo, hi } == std::tuple{ other.lo, other.hi };
+  }
+
+  bool operator!=( const CodingGenotypeHash& other ) const {
+    return !operator==( other );
+  }
+
+  bool operator<( const CodingGenotypeHash& other ) const {
+    return std::tuple{ lo, hi } < std::tuple{ other.lo, other.hi };
+  }
+
+};
+
+} // namespace dish2
+
+namespace std {
+
+template <>
+struct hash<dish2::CodingGenotypeHash> {
+
+  size_t operator()( const dish2::CodingGenotypeHash& hash ) const {
+    return hash.lo;
+  }
+
+};
+
+} // namespace std
+
+#endif // #ifndef DISH2_GENOME_CODINGGENOTYPEHASH_HPP_INCLUDE
@@ -14,6 +14,7 @@
 
 #include "../config/cfg.hpp"
 
+#include "CodingGenotypeHash.hpp"
 #include "EventTags.hpp"
 #include "GenerationCounter.hpp"
 #include "Genome.hpp"
@@ -21,6 +22,7 @@
 #include "KinGroupID.hpp"
 #include "MutationCounter.hpp"
 #include "RootID.hpp"
+#include "TaxonID.hpp"
 
 namespace dish2 {
 
@@ -39,6 +41,10 @@ struct Genome {
   program_t program;
   dish2::RootID root_id;
   dish2::RootID stint_root_id;
+  // assigned by dish2::PhylogenyTracker, not saved with genome
+  dish2::TaxonID taxon_id;
+  // kept in sync with event_tags and program, see RefreshCodingGenotypeHash
+  dish2::CodingGenotypeHash coding_genotype_hash;
 
   Genome() = default;
 
@@ -49,10 +55,11 @@ struct Genome {
   , root_id( std::in_place )
   , stint_root_id( std::in_place ) {
     program.RotateGlobalAnchorToFront();
+    RefreshCodingGenotypeHash();
   }
 
   bool operator==(const Genome& other) const {
-    // ignore kin_group_epoch_stamps,
+    // ignore kin_group_epoch_stamps, taxon_id, coding_genotype_hash
     return std::tuple{
       event_tags,
       generation_counter,
@@ -73,7 +80,7 @@ struct Genome {
   }
 
   bool operator<(const Genome& other) const {
-    // ignore kin_group_epoch_stamps,
+    // ignore kin_group_epoch_stamps, taxon_id, coding_genotype_hash
     return std::tuple{
       event_tags,
       generation_counter,
@@ -109,9 +116,11 @@ struct Genome {
       mutation_counter.RecordPointMutation(
         event_tags.ApplyPointMutations( dish2::cfg.POINT_MUTATION_RATE() )
       );
+      RefreshCodingGenotypeHash();
     }
 
     // root_id and stint_root_id doesn't change
+    // taxon_id is reassigned by dish2::PhylogenyTracker
 
   }
 
@@ -145,21 +154,33 @@ struct Genome {
 
   }
 
+  /// Must be called after modifying event_tags or program directly.
+  void RefreshCodingGenotypeHash() {
+    coding_genotype_hash = dish2::CodingGenotypeHash{ event_tags, program };
+  }
+
+  const dish2::CodingGenotypeHash& GetCodingGenotypeHash() const {
+    return coding_genotype_hash;
+  }
+
   void SetupSeededGenotype() {
     kin_group_id = dish2::KinGroupID<Spec>{ std::in_place };
     stint_root_id = dish2::RootID{ std::in_place };
   }
 
   template <class Archive>
-  void serialize( Archive & ar ) { ar(
-    CEREAL_NVP( event_tags ),
-    CEREAL_NVP( generation_counter ),
-    CEREAL_NVP( mutation_counter ),
-    CEREAL_NVP( kin_group_id ),
-    CEREAL_NVP( program ),
-    CEREAL_NVP( root_id ),
-    CEREAL_NVP( stint_root_id )
-  ); }
+  void serialize( Archive & ar ) {
+    ar(
+      CEREAL_NVP( event_tags ),
+      CEREAL_NVP( generation_counter ),
+      CEREAL_NVP( mutation_counter ),
+      CEREAL_NVP( kin_group_id ),
+      CEREAL_NVP( program ),
+      CEREAL_NVP( root_id ),
+      CEREAL_NVP( stint_root_id )
+    );
+    if constexpr ( Archive::is_loading::value ) RefreshCodingGenotypeHash();
+  }
 
 };
 
@@ -0,0 +1,57 @@
+#pragma once
+#ifndef DISH2_GENOME_TAXONID_HPP_INCLUDE
+#define DISH2_GENOME_TAXONID_HPP_INCLUDE
+
+#include <atomic>
+#include <ratio>
+#include <utility>
+
+#include "../../../third-party/conduit/include/uitsl/debug/audit_cast.hpp"
+#include "../../../third-party/conduit/include/uitsl/math/math_utils.hpp"
+#include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
+
+namespace dish2 {
+
+/// Identifies a genome's taxon in the `dish2::PhylogenyTracker`.
+/// Unique across processes. Zero means untracked.
+class TaxonID {
+
+  inline static std::atomic< size_t > taxon_id_counter{ 1 };
+
+  size_t taxon_id{};
+
+public:
+
+  TaxonID() = default;
+
+  TaxonID(std::in_place_t) : taxon_id( uitsl::sidebyside_hash<
+    std::ratio<3, 4>
+  >(
+    uitsl::audit_cast<size_t>( uitsl::get_proc_id() ),
+    taxon_id_counter++
+  ) ) {}
+
+  TaxonID(const size_t taxon_id_) : taxon_id( taxon_id_ ) {}
+
+  bool operator<(const TaxonID& other) const {
+    return taxon_id < other.taxon_id;
+  }
+
+  bool operator==(const TaxonID& other) const {
+    return taxon_id == other.taxon_id;
+  }
+
+  bool operator!=(const TaxonID& other) const { return !operator==(other); }
+
+  explicit operator bool() const { return taxon_id; }
+
+  template <class Archive>
+  void serialize( Archive & ar ) { ar( CEREAL_NVP( taxon_id ) ); }
+
+  size_t GetID() const { return taxon_id; }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_GENOME_TAXONID_HPP_INCLUDE
@@ -0,0 +1,176 @@
+#pragma once
+#ifndef DISH2_GENOME_WIREGENOME_HPP_INCLUDE
+#define DISH2_GENOME_WIREGENOME_HPP_INCLUDE
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <zlib.h>
+
+#include "../../../third-party/cereal/include/cereal/cereal.hpp"
+#include "../../../third-party/cereal/include/cereal/types/string.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+
+#include "../config/cfg.hpp"
+
+#include "Genome.hpp"
+
+namespace dish2 {
+
+namespace internal::wire_genome {
+
+  // deflate state is large, so streams are reset between programs rather
+  // than reallocated
+  struct Deflater {
+    z_stream stream{};
+    int level;
+    explicit Deflater( const int level_ ) : level( level_ ) {
+      emp_always_assert( deflateInit( &stream, level ) == Z_OK, level );
+    }
+    ~Deflater() { deflateEnd( &stream ); }
+  };
+
+  struct Inflater {
+    z_stream stream{};
+    Inflater() { emp_always_assert( inflateInit( &stream ) == Z_OK ); }
+    ~Inflater() { inflateEnd( &stream ); }
+  };
+
+} // namespace internal::wire_genome
+
+/// Genome as sent through the genome mesh.
+/// Serializes the program as one byte blob rather than with cereal's
+/// per-instruction encoding.
+/// If `GENOME_WIRE_COMPRESSION_LEVEL` is nonzero, the blob is deflated.
+/// Evolved tags are close to random, so deflate saves only about a fifth of
+/// the bytes and costs tens of microseconds per program, which is only worth
+/// paying on slow links between processes.
+/// Other fields serialize as in `dish2::Genome`, plus `taxon_id` so that
+/// offspring can be linked to their parent's taxon.
+/// Programs aren't delta encoded, because the base genome a delta would
+/// refer to isn't known to be held by the receiver.
+template<typename Spec>
+struct WireGenome : public dish2::Genome<Spec> {
+
+  using parent_t = dish2::Genome<Spec>;
+  using instruction_t = typename parent_t::program_t::value_type;
+  static_assert( std::is_trivially_copyable_v< instruction_t > );
+
+  WireGenome() = default;
+
+  WireGenome( const parent_t& genome ) : parent_t( genome ) {}
+
+  /// Reuses this genome's storage, so a long-lived WireGenome can be
+  /// refilled for each send without allocating.
+  WireGenome& operator=( const parent_t& genome ) {
+    parent_t::operator=( genome );
+    return *this;
+  }
+
+  // hides dish2::Genome::serialize
+  template <class Archive>
+  void serialize( Archive & ar ) {
+    ar(
+      cereal::make_nvp( "event_tags", this->event_tags ),
+      cereal::make_nvp( "generation_counter", this->generation_counter ),
+      cereal::make_nvp( "mutation_counter", this->mutation_counter ),
+      cereal::make_nvp( "kin_group_id", this->kin_group_id ),
+      cereal::make_nvp( "root_id", this->root_id ),
+      cereal::make_nvp( "stint_root_id", this->stint_root_id ),
+      cereal::make_nvp( "taxon_id", this->taxon_id )
+    );
+
+    if constexpr ( Archive::is_saving::value ) SaveProgram( ar );
+    else {
+      LoadProgram( ar );
+      this->RefreshCodingGenotypeHash();
+    }
+  }
+
+private:
+
+  template <class Archive>
+  void SaveProgram( Archive & ar ) {
+
+    const auto& program = this->program;
+    const uint64_t num_instructions = program.size();
+    const uLong num_bytes = num_instructions * sizeof( instruction_t );
+    const auto* bytes = reinterpret_cast<const Bytef*>( program.data() );
+
+    thread_local std::string blob;
+    const int level = dish2::cfg.GENOME_WIRE_COMPRESSION_LEVEL();
+    const bool compressed = level;
+    if ( compressed ) {
+      thread_local internal::wire_genome::Deflater deflater( level );
+      auto& stream = deflater.stream;
+      emp_always_assert( deflateReset( &stream ) == Z_OK );
+      if ( std::exchange( deflater.level, level ) != level ) {
+        emp_always_assert(
+          deflateParams( &stream, level, Z_DEFAULT_STRATEGY ) == Z_OK, level
+        );
+      }
+
+      blob.resize( deflateBound( &stream, num_bytes ) );
+      stream.next_in = const_cast<Bytef*>( bytes );
+      stream.avail_in = num_bytes;
+      stream.next_out = reinterpret_cast<Bytef*>( blob.data() );
+      stream.avail_out = blob.size();
+      emp_always_assert( deflate( &stream, Z_FINISH ) == Z_STREAM_END );
+      blob.resize( stream.total_out );
+    } else blob.assign( reinterpret_cast<const char*>( bytes ), num_bytes );
+
+    ar(
+      CEREAL_NVP( num_instructions ),
+      CEREAL_NVP( compressed ),
+      CEREAL_NVP( blob )
+    );
+
+  }
+
+  template <class Archive>
+  void LoadProgram( Archive & ar ) {
+
+    uint64_t num_instructions;
+    bool compressed;
+    thread_local std::string blob;
+    ar(
+      CEREAL_NVP( num_instructions ),
+      CEREAL_NVP( compressed ),
+      CEREAL_NVP( blob )
+    );
+
+    auto& program = this->program;
+    program.resize( num_instructions );
+    const uLong num_bytes = num_instructions * sizeof( instruction_t );
+    auto* bytes = reinterpret_cast<Bytef*>( program.data() );
+
+    if ( compressed ) {
+      thread_local internal::wire_genome::Inflater inflater;
+      auto& stream = inflater.stream;
+      emp_always_assert( inflateReset( &stream ) == Z_OK );
+
+      stream.next_in = reinterpret_cast<Bytef*>( blob.data() );
+      stream.avail_in = blob.size();
+      stream.next_out = bytes;
+      stream.avail_out = num_bytes;
+      emp_always_assert( inflate( &stream, Z_FINISH ) == Z_STREAM_END );
+      emp_always_assert(
+        stream.total_out == num_bytes, stream.total_out, num_instructions
+      );
+    } else {
+      emp_always_assert(
+        blob.size() == num_bytes, blob.size(), num_instructions
+      );
+      std::memcpy( bytes, blob.data(), num_bytes );
+    }
+
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_GENOME_WIREGENOME_HPP_INCLUDE
@@ -0,0 +1,214 @@
+#pragma once
+#ifndef DISH2_INTROSPECTION_DISTINCTCOUNTSKETCHES_HPP_INCLUDE
+#define DISH2_INTROSPECTION_DISTINCTCOUNTSKETCHES_HPP_INCLUDE
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+#include "../../../third-party/signalgp-lite/include/sgpl/introspection/summarize_module_expression.hpp"
+#include "../../../third-party/signalgp-lite/include/sgpl/introspection/summarize_module_regulation.hpp"
+
+#include "../utility/HyperLogLog.hpp"
+#include "../utility/murmur_hash_128.hpp"
+#include "../utility/reduce_parallel.hpp"
+#include "../world/ThreadWorld.hpp"
+
+namespace dish2 {
+
+/// HyperLogLog sketches of distinct coding genotypes, root IDs, stint root
+/// IDs, and module expression and regulation profiles among live cells,
+/// built in a single pass.
+/// Alternative to `dish2::count_unique_coding_genotypes`,
+/// `dish2::count_unique_root_ids`, `dish2::count_unique_stint_root_ids`,
+/// `dish2::count_unique_module_expression_profiles`, and
+/// `dish2::count_unique_module_regulation_profiles` in constant memory.
+/// Sketches from different threads or processes may be merged.
+template< typename Spec >
+class DistinctCountSketches {
+
+  enum Sketch : size_t {
+    coding_genotypes,
+    root_ids,
+    stint_root_ids,
+    module_expression_profiles,
+    module_regulation_profiles,
+    num_sketches
+  };
+
+  // HyperLogLog isn't default constructible, so not emp::array
+  using sketches_t = std::array< dish2::HyperLogLog, num_sketches >;
+  sketches_t sketches;
+
+  // equal floating point values, as -0.0 and 0.0 or NaNs with different
+  // payloads, may differ bitwise
+  template< typename T >
+  static T canonicalize( const T value ) {
+    if constexpr ( std::is_floating_point_v< T > ) {
+      if ( std::isnan( value ) ) return std::numeric_limits< T >::quiet_NaN();
+      else if ( value == 0 ) return T{};
+    }
+    return value;
+  }
+
+  template< typename Profile >
+  static uint64_t hash_profile( const Profile& profile ) {
+    using value_t = typename Profile::value_type;
+    // hashed bytewise, so must have no padding
+    static_assert( std::is_arithmetic_v< value_t > );
+
+    thread_local emp::vector< value_t > canonical;
+    canonical.clear();
+    std::transform(
+      std::begin( profile ), std::end( profile ),
+      std::back_inserter( canonical ),
+      canonicalize< value_t >
+    );
+
+    return dish2::murmur_hash_128( std::span< const std::byte >(
+      reinterpret_cast< const std::byte* >( canonical.data() ),
+      canonical.size() * sizeof( value_t )
+    ) ).first;
+  }
+
+  explicit DistinctCountSketches(
+    sketches_t&& sketches_
+  ) : sketches( std::move( sketches_ ) )
+  { }
+
+  template< typename CellIt >
+  void Insert( const CellIt first, const CellIt last ) {
+
+    for ( auto it = first; it != last; ++it ) if ( it->IsAlive() ) {
+
+      const auto& genome = *it->genome;
+
+      // cached hash is already uniformly distributed
+      sketches[ coding_genotypes ].Insert(
+        genome.GetCodingGenotypeHash().lo
+      );
+      sketches[ root_ids ].InsertUnhashed( genome.root_id.GetID() );
+      sketches[ stint_root_ids ].InsertUnhashed(
+        genome.stint_root_id.GetID()
+      );
+
+      for ( const auto& cardinal : *it ) {
+        sketches[ module_expression_profiles ].Insert( hash_profile(
+          sgpl::summarize_module_expression( cardinal.cpu, genome.program )
+        ) );
+        sketches[ module_regulation_profiles ].Insert( hash_profile(
+          sgpl::summarize_module_regulation( cardinal.cpu, genome.program )
+        ) );
+      }
+
+    }
+
+  }
+
+public:
+
+  /// @param precision log2 of number of registers in each sketch.
+  explicit DistinctCountSketches( const size_t precision )
+  : sketches{
+    dish2::HyperLogLog( precision ),
+    dish2::HyperLogLog( precision ),
+    dish2::HyperLogLog( precision ),
+    dish2::HyperLogLog( precision ),
+    dish2::HyperLogLog( precision )
+  } { }
+
+  /// Sketch live cells of population, replacing previous contents.
+  /// World must not be updated during the call.
+  /// @param num_threads maximum number of threads, or 0 to use hardware
+  /// concurrency.
+  void Run(
+    const dish2::ThreadWorld< Spec >& world, const size_t num_threads=1
+  ) {
+
+    const size_t precision = sketches.front().GetPrecision();
+    const auto& population = world.population;
+
+    *this = dish2::reduce_parallel(
+      std::begin( population ), std::end( population ),
+      [precision]( const auto first, const auto last ){
+        DistinctCountSketches res( precision );
+        res.Insert( first, last );
+        return res;
+      },
+      []( auto& accumulator, auto&& partial ){
+        accumulator.Merge( partial );
+      },
+      num_threads
+    );
+
+  }
+
+  /// Absorb all items sketched by other.
+  void Merge( const DistinctCountSketches& other ) {
+    for ( size_t i{}; i < num_sketches; ++i ) {
+      sketches[ i ].Merge( other.sketches[ i ] );
+    }
+  }
+
+  /// @return registers of all sketches, concatenated, for merging by
+  /// elementwise maximum.
+  emp::vector< uint8_t > GetRegisters() const {
+    emp::vector< uint8_t > res;
+    for ( const auto& sketch : sketches ) res.insert(
+      std::end( res ),
+      std::begin( sketch.GetRegisters() ), std::end( sketch.GetRegisters() )
+    );
+    return res;
+  }
+
+  /// Restore sketches from concatenated registers, as from GetRegisters.
+  static DistinctCountSketches FromRegisters(
+    const emp::vector< uint8_t >& registers
+  ) {
+    emp_assert( registers.size() % num_sketches == 0 );
+    const size_t stride = registers.size() / num_sketches;
+    const auto slice = [&registers, stride]( const size_t i ){
+      return dish2::HyperLogLog( emp::vector< uint8_t >(
+        std::next( std::begin( registers ), i * stride ),
+        std::next( std::begin( registers ), ( i + 1 ) * stride )
+      ) );
+    };
+    return DistinctCountSketches( sketches_t{
+      slice( 0 ), slice( 1 ), slice( 2 ), slice( 3 ), slice( 4 )
+    } );
+  }
+
+  double EstimateNumCodingGenotypes() const {
+    return sketches[ coding_genotypes ].Estimate();
+  }
+
+  double EstimateNumRootIDs() const {
+    return sketches[ root_ids ].Estimate();
+  }
+
+  double EstimateNumStintRootIDs() const {
+    return sketches[ stint_root_ids ].Estimate();
+  }
+
+  double EstimateNumModuleExpressionProfiles() const {
+    return sketches[ module_expression_profiles ].Estimate();
+  }
+
+  double EstimateNumModuleRegulationProfiles() const {
+    return sketches[ module_regulation_profiles ].Estimate();
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_INTROSPECTION_DISTINCTCOUNTSKETCHES_HPP_INCLUDE
@@ -0,0 +1,298 @@
+#pragma once
+#ifndef DISH2_INTROSPECTION_FUSEDPOPULATIONSCAN_HPP_INCLUDE
+#define DISH2_INTROSPECTION_FUSEDPOPULATIONSCAN_HPP_INCLUDE
+
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../cell/Cell.hpp"
+#include "../world/ThreadWorld.hpp"
+
+namespace dish2 {
+
+/// Computes many population metrics with a single pass over the population.
+/// Metrics register a per-cell accumulator, summed over either all cells or
+/// live cells, and a finalizer that turns the sum into the metric value.
+/// Metrics that can't be expressed per cell register a callable evaluated
+/// after the scan instead.
+/// Results are reported in registration order.
+/// Sums and counts from scans of disjoint populations may be merged to
+/// finalize per-cell metrics over their union.
+template< typename Spec >
+class FusedPopulationScan {
+
+public:
+
+  using cell_t = dish2::Cell< Spec >;
+  using world_t = dish2::ThreadWorld< Spec >;
+
+  using accumulator_t = std::function< double( const cell_t& ) >;
+  using finalizer_t = std::function<
+    double( double, const FusedPopulationScan& )
+  >;
+  using computed_t = std::function<
+    double( const world_t&, const FusedPopulationScan& )
+  >;
+  using derived_t = std::function< double( const FusedPopulationScan& ) >;
+
+  enum class Scope { all_cells, live_cells };
+
+private:
+
+  struct Fused {
+    accumulator_t accumulator;
+    finalizer_t finalizer;
+    // index of result
+    size_t result_idx;
+    double sum;
+  };
+
+  struct Computed {
+    computed_t computed;
+    size_t result_idx;
+  };
+
+  struct Derived {
+    derived_t derived;
+    size_t result_idx;
+  };
+
+  emp::vector< Fused > all_cell_metrics;
+  emp::vector< Fused > live_cell_metrics;
+  emp::vector< Computed > computed_metrics;
+  emp::vector< Derived > derived_metrics;
+
+  emp::vector< std::pair< std::string, double > > results;
+  // which results are per-cell or count metrics, which can be merged
+  emp::vector< bool > mergeable;
+
+  size_t update{};
+  size_t num_cells{};
+  size_t num_cardinals{};
+  size_t num_live_cells{};
+  size_t num_live_cardinals{};
+  // cardinals weighted by update of their scan, which differ across merged
+  // scans
+  size_t num_cardinal_updates{};
+  size_t num_live_cardinal_updates{};
+
+  // number of partial sums preceding per-metric sums
+  static constexpr size_t num_partial_counts = 6;
+
+  void Finalize() {
+    for ( const auto* metrics : { &all_cell_metrics, &live_cell_metrics } ) {
+      for ( const auto& metric : *metrics ) {
+        results[ metric.result_idx ].second
+          = metric.finalizer( metric.sum, *this );
+      }
+    }
+    for ( const auto& metric : derived_metrics ) {
+      results[ metric.result_idx ].second = metric.derived( *this );
+    }
+  }
+
+  static double Divide( const double numerator, const size_t denominator ) {
+    return denominator
+      ? numerator / denominator
+      : std::numeric_limits<double>::quiet_NaN();
+  }
+
+public:
+
+  /// Register metric finalized from sum of accumulator over scope.
+  void Add(
+    const std::string& name,
+    const Scope scope,
+    accumulator_t accumulator,
+    finalizer_t finalizer
+  ) {
+    auto& metrics = scope == Scope::all_cells
+      ? all_cell_metrics : live_cell_metrics;
+    metrics.push_back( Fused{
+      std::move( accumulator ), std::move( finalizer ), results.size(), 0.0
+    } );
+    results.emplace_back( name, 0.0 );
+    mergeable.push_back( true );
+  }
+
+  /// Register metric calculated from cell and cardinal counts alone, which
+  /// needs no per-cell accumulator and can be merged.
+  void AddFromCounts( const std::string& name, derived_t derived ) {
+    derived_metrics.push_back( Derived{
+      std::move( derived ), results.size()
+    } );
+    results.emplace_back( name, 0.0 );
+    mergeable.push_back( true );
+  }
+
+  /// Register metric evaluated after the scan.
+  void AddComputed( const std::string& name, computed_t computed ) {
+    computed_metrics.push_back( Computed{
+      std::move( computed ), results.size()
+    } );
+    results.emplace_back( name, 0.0 );
+    mergeable.push_back( false );
+  }
+
+  /// Register metric averaged over cells in scope, NaN if there are none.
+  void AddMeanPerCell(
+    const std::string& name, const Scope scope, accumulator_t accumulator
+  ) {
+    Add( name, scope, std::move( accumulator ),
+      [scope]( const double sum, const FusedPopulationScan& scan ){
+        return Divide(
+          sum,
+          scope == Scope::all_cells
+            ? scan.GetNumCells() : scan.GetNumLiveCells()
+        );
+      }
+    );
+  }
+
+  /// Register metric summed over live cells and averaged over live
+  /// cardinals, NaN if there are no live cells.
+  void AddMeanPerLiveCardinal(
+    const std::string& name, accumulator_t accumulator
+  ) {
+    Add( name, Scope::live_cells, std::move( accumulator ),
+      []( const double sum, const FusedPopulationScan& scan ){
+        return Divide( sum, scan.GetNumLiveCardinals() );
+      }
+    );
+  }
+
+  /// Scan population and finalize all registered metrics.
+  void Run( const world_t& world ) {
+
+    update = world.GetUpdate();
+    num_cells = 0;
+    num_cardinals = 0;
+    num_live_cells = 0;
+    num_live_cardinals = 0;
+    for ( auto& metric : all_cell_metrics ) metric.sum = 0.0;
+    for ( auto& metric : live_cell_metrics ) metric.sum = 0.0;
+
+    for ( const auto& cell : world.population ) {
+
+      ++num_cells;
+      num_cardinals += cell.GetNumCardinals();
+      for ( auto& metric : all_cell_metrics ) {
+        metric.sum += metric.accumulator( cell );
+      }
+
+      if ( !cell.IsAlive() ) continue;
+
+      ++num_live_cells;
+      num_live_cardinals += cell.GetNumCardinals();
+      for ( auto& metric : live_cell_metrics ) {
+        metric.sum += metric.accumulator( cell );
+      }
+
+    }
+
+    num_cardinal_updates = num_cardinals * update;
+    num_live_cardinal_updates = num_live_cardinals * update;
+
+    Finalize();
+
+    for ( const auto& metric : computed_metrics ) {
+      results[ metric.result_idx ].second = metric.computed( world, *this );
+    }
+
+  }
+
+  /// @return counts and per-cell metric sums from most recent run.
+  /// Partial sums from scans of disjoint populations registered with the
+  /// same metrics may be summed elementwise and passed to Merge.
+  emp::vector< double > GetPartialSums() const {
+    emp::vector< double > res{
+      static_cast<double>( num_cells ),
+      static_cast<double>( num_cardinals ),
+      static_cast<double>( num_live_cells ),
+      static_cast<double>( num_live_cardinals ),
+      static_cast<double>( num_cardinal_updates ),
+      static_cast<double>( num_live_cardinal_updates )
+    };
+    emp_assert( res.size() == num_partial_counts );
+    for ( const auto* metrics : { &all_cell_metrics, &live_cell_metrics } ) {
+      for ( const auto& metric : *metrics ) res.push_back( metric.sum );
+    }
+    return res;
+  }
+
+  /// Finalize per-cell and count metrics from summed partial sums, as if a
+  /// single scan had covered every contributing population.
+  /// Metrics evaluated after the scan can't be merged and become NaN.
+  /// @param merged_update update to report for the merged scan, such as the
+  /// least update of contributing scans.
+  void Merge(
+    const emp::vector< double >& partial_sums, const size_t merged_update
+  ) {
+
+    emp_assert( partial_sums.size() == num_partial_counts
+      + all_cell_metrics.size() + live_cell_metrics.size()
+    );
+
+    update = merged_update;
+    num_cells = partial_sums[0];
+    num_cardinals = partial_sums[1];
+    num_live_cells = partial_sums[2];
+    num_live_cardinals = partial_sums[3];
+    num_cardinal_updates = partial_sums[4];
+    num_live_cardinal_updates = partial_sums[5];
+
+    auto it = std::next( std::begin( partial_sums ), num_partial_counts );
+    for ( auto* metrics : { &all_cell_metrics, &live_cell_metrics } ) {
+      for ( auto& metric : *metrics ) metric.sum = *it++;
+    }
+
+    Finalize();
+
+    for ( const auto& metric : computed_metrics ) {
+      results[ metric.result_idx ].second
+        = std::numeric_limits<double>::quiet_NaN();
+    }
+
+  }
+
+  size_t GetUpdate() const { return update; }
+
+  size_t GetNumCells() const { return num_cells; }
+
+  size_t GetNumCardinals() const { return num_cardinals; }
+
+  size_t GetNumLiveCells() const { return num_live_cells; }
+
+  size_t GetNumLiveCardinals() const { return num_live_cardinals; }
+
+  /// @return sum over cardinals of their scan's update.
+  size_t GetNumCardinalUpdates() const { return num_cardinal_updates; }
+
+  /// @return sum over live cardinals of their scan's update.
+  size_t GetNumLiveCardinalUpdates() const {
+    return num_live_cardinal_updates;
+  }
+
+  size_t GetNumMetrics() const { return results.size(); }
+
+  /// @return metric names and values from most recent run, in registration
+  /// order.
+  const auto& GetResults() const { return results; }
+
+  /// @return whether result at index is a per-cell or count metric, which
+  /// is valid after Merge.
+  bool IsMergeable( const size_t result_idx ) const {
+    return mergeable[ result_idx ];
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_INTROSPECTION_FUSEDPOPULATIONSCAN_HPP_INCLUDE
@@ -0,0 +1,145 @@
+#pragma once
+#ifndef DISH2_INTROSPECTION_KINGROUPSIZESTATS_HPP_INCLUDE
+#define DISH2_INTROSPECTION_KINGROUPSIZESTATS_HPP_INCLUDE
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include "../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../cell/cardinal_iterators/KinGroupIDViewWrapper.hpp"
+#include "../world/ThreadWorld.hpp"
+
+namespace dish2 {
+
+/// Kin group size statistics for every level, from a single pass over the
+/// population.
+/// Kin group IDs of live cells are gathered into flat per-level buffers,
+/// which are sorted so that each kin group's size is the length of a run.
+/// Buffers are reused between runs to avoid reallocation.
+/// Statistics agree with `dish2::get_maximum_kin_group_size`,
+/// `dish2::get_mean_kin_group_size`, `dish2::get_median_kin_group_size`,
+/// `dish2::get_num_kin_group_loners`, and
+/// `dish2::get_fraction_cells_kin_group_loners`.
+template< typename Spec >
+class KinGroupSizeStats {
+
+  struct LevelStats {
+    size_t num_groups;
+    size_t max_size;
+    size_t median_size;
+    size_t num_loners;
+  };
+
+  // kin group ID of each live cell, per level
+  emp::array< emp::vector< size_t >, Spec::NLEV > kin_group_ids;
+  // scratch space for median calculation
+  emp::vector< size_t > group_sizes;
+
+  emp::array< LevelStats, Spec::NLEV > stats{};
+  size_t num_live_cells{};
+
+  static constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+
+  void Tally( const size_t lev ) {
+
+    auto& ids = kin_group_ids[ lev ];
+    std::sort( std::begin( ids ), std::end( ids ) );
+
+    group_sizes.clear();
+    for ( auto it = std::begin( ids ); it != std::end( ids ); ) {
+      const auto run_end = std::upper_bound( it, std::end( ids ), *it );
+      group_sizes.push_back( std::distance( it, run_end ) );
+      it = run_end;
+    }
+
+    auto& res = stats[ lev ];
+    res = LevelStats{};
+    res.num_groups = group_sizes.size();
+    if ( group_sizes.empty() ) return;
+
+    res.max_size = *std::max_element(
+      std::begin( group_sizes ), std::end( group_sizes )
+    );
+    res.num_loners = std::count(
+      std::begin( group_sizes ), std::end( group_sizes ), 1
+    );
+
+    const size_t median_index = group_sizes.size() / 2;
+    std::nth_element(
+      std::begin( group_sizes ),
+      std::next( std::begin( group_sizes ), median_index ),
+      std::end( group_sizes )
+    );
+    res.median_size = group_sizes[ median_index ];
+
+  }
+
+public:
+
+  /// Scan population and tally kin group sizes at every level.
+  void Run( const dish2::ThreadWorld<Spec>& world ) {
+
+    for ( auto& ids : kin_group_ids ) ids.clear();
+    num_live_cells = 0;
+
+    for ( const auto& cell : world.population ) {
+      if ( !cell.IsAlive() ) continue;
+      ++num_live_cells;
+
+      // kin group ID as seen by first cardinal
+      const auto& kin_group_id_view
+        = *cell.template begin< dish2::KinGroupIDViewWrapper<Spec> >();
+      const auto& buffer = kin_group_id_view.GetBuffer();
+      for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+        kin_group_ids[ lev ].push_back( buffer[ lev ] );
+      }
+    }
+
+    for ( size_t lev{}; lev < Spec::NLEV; ++lev ) Tally( lev );
+
+  }
+
+  size_t GetNumLiveCells() const { return num_live_cells; }
+
+  size_t GetNumGroups( const size_t lev ) const {
+    emp_assert( lev < Spec::NLEV );
+    return stats[ lev ].num_groups;
+  }
+
+  /// @return NaN if there are no live cells.
+  double GetMaximumSize( const size_t lev ) const {
+    return GetNumGroups( lev ) ? stats[ lev ].max_size : nan;
+  }
+
+  /// @return NaN if there are no live cells.
+  double GetMeanSize( const size_t lev ) const {
+    return GetNumGroups( lev )
+      ? num_live_cells / static_cast<double>( GetNumGroups( lev ) )
+      : nan;
+  }
+
+  /// @return upper median, or NaN if there are no live cells.
+  double GetMedianSize( const size_t lev ) const {
+    return GetNumGroups( lev ) ? stats[ lev ].median_size : nan;
+  }
+
+  size_t GetNumLoners( const size_t lev ) const {
+    emp_assert( lev < Spec::NLEV );
+    return stats[ lev ].num_loners;
+  }
+
+  /// @return fraction of live cells with no kin, or NaN if there are no live
+  /// cells.
+  double GetFractionCellsLoners( const size_t lev ) const {
+    return GetNumLoners( lev ) / static_cast<double>( num_live_cells );
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_INTROSPECTION_KINGROUPSIZESTATS_HPP_INCLUDE
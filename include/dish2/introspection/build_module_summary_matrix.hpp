@@ -0,0 +1,106 @@
+#pragma once
+#ifndef DISH2_INTROSPECTION_BUILD_MODULE_SUMMARY_MATRIX_HPP_INCLUDE
+#define DISH2_INTROSPECTION_BUILD_MODULE_SUMMARY_MATRIX_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../third-party/header-only-pca/include/hopca/types.hpp"
+#include "../../../third-party/signalgp-lite/include/sgpl/introspection/count_modules.hpp"
+
+#include "../utility/reduce_parallel.hpp"
+#include "../world/ThreadWorld.hpp"
+
+namespace dish2 {
+
+/// Build matrix with a row for each live cardinal and a block of columns for
+/// each summary of that cardinal's modules.
+/// Each summary takes the maximum module count of any live cell's program
+/// columns, zero padded.
+/// Matrix dimensions and row positions are found in a single pass over the
+/// population, then rows are filled concurrently into a preallocated
+/// buffer, which is copied into the returned matrix.
+/// World must not be updated during the call.
+/// @param summarize callables taking a cardinal's cpu and program and
+/// returning a vector of per-module values, one per column block.
+/// @param num_threads maximum number of threads, or 0 to use hardware
+/// concurrency.
+template< typename Spec, typename... Summarize >
+hopca::Matrix build_module_summary_matrix(
+  const dish2::ThreadWorld< Spec >& world,
+  const size_t num_threads,
+  const Summarize&... summarize
+) {
+
+  const auto& population = world.population;
+
+  struct LiveCell {
+    size_t cell_idx;
+    size_t row_begin;
+  };
+
+  emp::vector< LiveCell > live_cells;
+  size_t num_rows{};
+  size_t max_modules{};
+  for ( size_t cell_idx{}; cell_idx < population.size(); ++cell_idx ) {
+    const auto& cell = population[ cell_idx ];
+    if ( !cell.IsAlive() ) continue;
+    live_cells.push_back( LiveCell{ cell_idx, num_rows } );
+    num_rows += cell.GetNumCardinals();
+    max_modules = std::max(
+      max_modules, sgpl::count_modules( cell.genome->program )
+    );
+  }
+
+  const size_t num_cols = sizeof...( Summarize ) * max_modules;
+
+  // zero initialized, providing padding
+  emp::vector< double > res( num_rows * num_cols );
+
+  const auto fill_block = [max_modules]( double* block, const auto& summary ){
+    std::copy_n(
+      std::begin( summary ),
+      std::min< size_t >( summary.size(), max_modules ),
+      block
+    );
+    return block + max_modules;
+  };
+
+  // rows are written in place, so partial results only count rows
+  [[maybe_unused]] const size_t num_filled = dish2::reduce_parallel(
+    std::begin( live_cells ), std::end( live_cells ),
+    [&]( const auto first, const auto last ){
+      size_t num_filled{};
+      for ( auto it = first; it != last; ++it ) {
+        const auto& cell = population[ it->cell_idx ];
+        double* row = res.data() + it->row_begin * num_cols;
+        for ( const auto& cardinal : cell ) {
+          double* block = row;
+          ( ..., (
+            block = fill_block(
+              block, summarize( cardinal.cpu, cell.genome->program )
+            )
+          ) );
+          row += num_cols;
+          ++num_filled;
+        }
+      }
+      return num_filled;
+    },
+    []( size_t& accumulator, const size_t partial ){
+      accumulator += partial;
+    },
+    num_threads
+  );
+  emp_assert( num_filled == num_rows, num_filled, num_rows );
+
+  return hola::matrix_from_array( res.data(), num_rows, num_cols );
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_INTROSPECTION_BUILD_MODULE_SUMMARY_MATRIX_HPP_INCLUDE
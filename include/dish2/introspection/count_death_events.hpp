@@ -2,12 +2,7 @@
 #ifndef DISH2_INTROSPECTION_COUNT_DEATH_EVENTS_HPP_INCLUDE
 #define DISH2_INTROSPECTION_COUNT_DEATH_EVENTS_HPP_INCLUDE
 
-#include <algorithm>
-
-#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
-
 #include "../runninglog/DeathEvent.hpp"
-#include "../world/iterators/LogIteratorAdapter.hpp"
 #include "../world/ThreadWorld.hpp"
 
 namespace dish2 {
@@ -15,18 +10,9 @@ namespace dish2 {
 template< typename Spec >
 size_t count_death_events( const dish2::ThreadWorld<Spec>& world ) {
 
-  const auto& population = world.population;
-
-  return std::accumulate(
-    std::begin( population ), std::end( population ),
-    0,
-    []( const size_t accumulator, const auto& cell ){
-      const auto& log = cell.running_logs.template GetLog<
-        dish2::DeathEvent<Spec>
-      >();
-      return accumulator + log.GetSize();
-    }
-  );
+  return world.template GetRunningLogSummary<
+    dish2::DeathEvent<Spec>
+  >().GetSize();
 
 }
 
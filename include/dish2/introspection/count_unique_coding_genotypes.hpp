@@ -2,15 +2,11 @@
 #ifndef DISH2_INTROSPECTION_COUNT_UNIQUE_CODING_GENOTYPES_HPP_INCLUDE
 #define DISH2_INTROSPECTION_COUNT_UNIQUE_CODING_GENOTYPES_HPP_INCLUDE
 
-#include <iterator>
-#include <set>
-#include <type_traits>
-
-#include "../../../third-party/Empirical/include/emp/datastructs/tuple_utils.hpp"
-#include "../../../third-party/signalgp-lite/include/sgpl/introspection/count_modules.hpp"
+#include <algorithm>
+#include <unordered_set>
 
 #include "../cell/Cell.hpp"
-#include "../world/iterators/CodingGenotypeConstWrapper.hpp"
+#include "../genome/CodingGenotypeHash.hpp"
 #include "../world/iterators/LiveCellIterator.hpp"
 #include "../world/ThreadWorld.hpp"
 
@@ -21,15 +17,19 @@ size_t count_unique_coding_genotypes( const dish2::ThreadWorld<Spec>& world ) {
 
   const auto& population = world.population;
 
-  using wrapper_t = dish2::CodingGenotypeConstWrapper<
-    Spec,
-    dish2::LiveCellIterator<Spec>
-  >;
+  // compare cached hashes rather than whole programs
+  std::unordered_set< dish2::CodingGenotypeHash > unique;
+  unique.reserve( population.size() );
+
+  std::for_each(
+    dish2::LiveCellIterator<Spec>::make_begin( population ),
+    dish2::LiveCellIterator<Spec>::make_end( population ),
+    [&unique]( const auto& cell ){
+      unique.insert( cell.genome->GetCodingGenotypeHash() );
+    }
+  );
 
-  return std::set< std::remove_const_t<typename wrapper_t::value_type> >(
-    wrapper_t{ dish2::LiveCellIterator<Spec>::make_begin( population ) },
-    wrapper_t{ dish2::LiveCellIterator<Spec>::make_end( population ) }
-  ).size();
+  return unique.size();
 
 }
 
@@ -0,0 +1,53 @@
+#pragma once
+#ifndef DISH2_INTROSPECTION_COUNT_UNIQUE_CODING_GENOTYPES_PARALLEL_HPP_INCLUDE
+#define DISH2_INTROSPECTION_COUNT_UNIQUE_CODING_GENOTYPES_PARALLEL_HPP_INCLUDE
+
+#include <iterator>
+#include <unordered_set>
+#include <utility>
+
+#include "../cell/Cell.hpp"
+#include "../genome/CodingGenotypeHash.hpp"
+#include "../utility/reduce_parallel.hpp"
+#include "../world/ThreadWorld.hpp"
+
+namespace dish2 {
+
+/// Equivalent to `dish2::count_unique_coding_genotypes`, with population
+/// chunks hashed into separate sets concurrently.
+/// World must not be updated during the call.
+/// @param num_threads maximum number of threads, or 0 to use hardware
+/// concurrency.
+template< typename Spec >
+size_t count_unique_coding_genotypes_parallel(
+  const dish2::ThreadWorld<Spec>& world, const size_t num_threads=0
+) {
+
+  using set_t = std::unordered_set< dish2::CodingGenotypeHash >;
+
+  const auto& population = world.population;
+
+  return dish2::reduce_parallel(
+    std::begin( population ), std::end( population ),
+    []( const auto first, const auto last ){
+      set_t res;
+      res.reserve( std::distance( first, last ) );
+      for ( auto it = first; it != last; ++it ) if ( it->IsAlive() ) {
+        res.insert( it->genome->GetCodingGenotypeHash() );
+      }
+      return res;
+    },
+    []( set_t& accumulator, set_t&& partial ){
+      if ( partial.size() > accumulator.size() ) {
+        std::swap( accumulator, partial );
+      }
+      accumulator.merge( partial );
+    },
+    num_threads
+  ).size();
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_INTROSPECTION_COUNT_UNIQUE_CODING_GENOTYPES_PARALLEL_HPP_INCLUDE
@@ -0,0 +1,60 @@
+#pragma once
+#ifndef DISH2_INTROSPECTION_COUNT_UNIQUE_MODULE_EXPRESSION_PROFILES_PARALLEL_HPP_INCLUDE
+#define DISH2_INTROSPECTION_COUNT_UNIQUE_MODULE_EXPRESSION_PROFILES_PARALLEL_HPP_INCLUDE
+
+#include <cstddef>
+#include <iterator>
+#include <set>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../third-party/signalgp-lite/include/sgpl/introspection/summarize_module_expression.hpp"
+
+#include "../utility/reduce_parallel.hpp"
+#include "../world/ThreadWorld.hpp"
+
+namespace dish2 {
+
+/// Equivalent to `dish2::count_unique_module_expression_profiles`, with
+/// population chunks summarized concurrently.
+/// World must not be updated during the call.
+/// @param num_threads maximum number of threads, or 0 to use hardware
+/// concurrency.
+template< typename Spec >
+size_t count_unique_module_expression_profiles_parallel(
+  const dish2::ThreadWorld< Spec >& world, const size_t num_threads=0
+) {
+
+  using profile_t = emp::vector<size_t>;
+  using set_t = std::set<profile_t>;
+
+  const auto& population = world.population;
+
+  return dish2::reduce_parallel(
+    std::begin( population ), std::end( population ),
+    []( const auto first, const auto last ){
+      set_t res;
+      for ( auto it = first; it != last; ++it ) if ( it->IsAlive() ) {
+        for ( const auto& cardinal : *it ) {
+          res.insert( sgpl::summarize_module_expression(
+            cardinal.cpu,
+            it->genome->program
+          ) );
+        }
+      }
+      return res;
+    },
+    []( set_t& accumulator, set_t&& partial ){
+      if ( partial.size() > accumulator.size() ) {
+        std::swap( accumulator, partial );
+      }
+      accumulator.merge( partial );
+    },
+    num_threads
+  ).size();
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_INTROSPECTION_COUNT_UNIQUE_MODULE_EXPRESSION_PROFILES_PARALLEL_HPP_INCLUDE
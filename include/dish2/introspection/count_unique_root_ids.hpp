@@ -4,6 +4,7 @@
 
 #include <set>
 
+#include "../phylogeny/RootAbundanceTable.hpp"
 #include "../world/ThreadWorld.hpp"
 
 #include "get_unique_root_ids.hpp"
@@ -13,7 +14,9 @@ namespace dish2 {
 template< typename Spec >
 size_t count_unique_root_ids( const dish2::ThreadWorld<Spec>& world ) {
 
-  return dish2::get_unique_root_ids<Spec>( world ).size();
+  const auto& table = dish2::RootAbundanceTable::Get();
+  if ( table.IsOpenFor( world ) ) return table.GetNumRoots();
+  else return dish2::get_unique_root_ids<Spec>( world ).size();
 
 }
 
@@ -0,0 +1,55 @@
+#pragma once
+#ifndef DISH2_INTROSPECTION_GET_KIN_GROUP_SIZES_PARALLEL_HPP_INCLUDE
+#define DISH2_INTROSPECTION_GET_KIN_GROUP_SIZES_PARALLEL_HPP_INCLUDE
+
+#include <iterator>
+#include <unordered_map>
+
+#include "../cell/cardinal_iterators/KinGroupIDViewWrapper.hpp"
+#include "../utility/reduce_parallel.hpp"
+#include "../world/ThreadWorld.hpp"
+
+namespace dish2 {
+
+/// Equivalent to `dish2::get_kin_group_sizes`, with population chunks tallied
+/// concurrently.
+/// World must not be updated during the call.
+/// @param num_threads maximum number of threads, or 0 to use hardware
+/// concurrency.
+/// @return map of kin group IDs to counts.
+template< typename Spec >
+auto get_kin_group_sizes_parallel(
+  const dish2::ThreadWorld<Spec>& world,
+  const size_t lev,
+  const size_t num_threads=0
+) {
+
+  using map_t = std::unordered_map<size_t, size_t>;
+
+  const auto& population = world.population;
+
+  return dish2::reduce_parallel(
+    std::begin( population ), std::end( population ),
+    [lev]( const auto first, const auto last ){
+      map_t res;
+      for ( auto it = first; it != last; ++it ) if ( it->IsAlive() ) {
+        // kin group ID as seen by first cardinal
+        const auto& kin_group_id_view
+          = *it->template begin< dish2::KinGroupIDViewWrapper<Spec> >();
+        ++res[ kin_group_id_view.GetBuffer()[ lev ] ];
+      }
+      return res;
+    },
+    []( map_t& accumulator, map_t&& partial ){
+      for ( const auto& [kin_group_id, count] : partial ) {
+        accumulator[ kin_group_id ] += count;
+      }
+    },
+    num_threads
+  );
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_INTROSPECTION_GET_KIN_GROUP_SIZES_PARALLEL_HPP_INCLUDE
@@ -4,19 +4,19 @@
 
 #include <algorithm>
 #include <limits>
-#include <sstream>
-
-#include "../../../third-party/cereal/include/cereal/archives/binary.hpp"
 
+#include "../config/cfg.hpp"
 #include "../utility/measure_compression_ratio.hpp"
 #include "../world/iterators/LiveCellIterator.hpp"
 #include "../world/ThreadWorld.hpp"
 
 #include "count_live_cells.hpp"
-#include "no_live_cells.hpp"
 
 namespace dish2 {
 
+/// Estimated from `GENOME_COMPRESSION_RATIO_SAMPLE_SIZE` evenly-spaced live
+/// cells, if set.
+/// Sampling is deterministic so as not to perturb simulation randomness.
 template< typename Spec >
 double get_mean_genome_compression_ratio(
   const dish2::ThreadWorld<Spec>& world
@@ -26,21 +26,28 @@ double get_mean_genome_compression_ratio(
 
   using lcit_t = dish2::LiveCellIterator<Spec>;
 
-  if ( dish2::no_live_cells<Spec>( world ) ) {
-    return std::numeric_limits<double>::quiet_NaN();
-  } else return std::accumulate(
-    lcit_t::make_begin( population ),
-    lcit_t::make_end( population ),
-    0.0,
-    [](const double accum, const auto& cell){
-      return accum + dish2::measure_compression_ratio([&](){
-        std::ostringstream ss;
-        cereal::BinaryOutputArchive archive( ss );
-        archive( *cell.genome );
-        return ss.str();
-      }());
-    }
-  ) / dish2::count_live_cells<Spec>( world );
+  const size_t num_live_cells = dish2::count_live_cells<Spec>( world );
+  if ( num_live_cells == 0 ) return std::numeric_limits<double>::quiet_NaN();
+
+  const size_t sample_size = dish2::cfg.GENOME_COMPRESSION_RATIO_SAMPLE_SIZE();
+  const size_t num_samples = sample_size
+    ? std::min( sample_size, num_live_cells )
+    : num_live_cells;
+
+  // take the ith live cell for each i = floor( k * num_live / num_samples )
+  double accum{};
+  size_t live_idx{};
+  size_t sample_idx{};
+  for (
+    auto it = lcit_t::make_begin( population );
+    sample_idx < num_samples;
+    ++it, ++live_idx
+  ) if ( live_idx == sample_idx * num_live_cells / num_samples ) {
+    accum += dish2::measure_serialized_compression_ratio( *it->genome );
+    ++sample_idx;
+  }
+
+  return accum / num_samples;
 
 }
 
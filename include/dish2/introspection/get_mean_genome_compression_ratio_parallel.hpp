@@ -0,0 +1,75 @@
+#pragma once
+#ifndef DISH2_INTROSPECTION_GET_MEAN_GENOME_COMPRESSION_RATIO_PARALLEL_HPP_INCLUDE
+#define DISH2_INTROSPECTION_GET_MEAN_GENOME_COMPRESSION_RATIO_PARALLEL_HPP_INCLUDE
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../config/cfg.hpp"
+#include "../genome/Genome.hpp"
+#include "../utility/measure_compression_ratio.hpp"
+#include "../utility/reduce_parallel.hpp"
+#include "../world/iterators/LiveCellIterator.hpp"
+#include "../world/ThreadWorld.hpp"
+
+#include "count_live_cells.hpp"
+
+namespace dish2 {
+
+/// Equivalent to `dish2::get_mean_genome_compression_ratio`, with sampled
+/// genomes compressed concurrently.
+/// World must not be updated during the call.
+/// @param num_threads maximum number of threads, or 0 to use hardware
+/// concurrency.
+template< typename Spec >
+double get_mean_genome_compression_ratio_parallel(
+  const dish2::ThreadWorld<Spec>& world, const size_t num_threads=0
+) {
+
+  const auto& population = world.population;
+
+  using lcit_t = dish2::LiveCellIterator<Spec>;
+
+  const size_t num_live_cells = dish2::count_live_cells<Spec>( world );
+  if ( num_live_cells == 0 ) return std::numeric_limits<double>::quiet_NaN();
+
+  const size_t sample_size = dish2::cfg.GENOME_COMPRESSION_RATIO_SAMPLE_SIZE();
+  const size_t num_samples = sample_size
+    ? std::min( sample_size, num_live_cells )
+    : num_live_cells;
+
+  // same sample as serial version
+  emp::vector< const dish2::Genome<Spec>* > samples;
+  samples.reserve( num_samples );
+  size_t live_idx{};
+  for (
+    auto it = lcit_t::make_begin( population );
+    samples.size() < num_samples;
+    ++it, ++live_idx
+  ) if ( live_idx == samples.size() * num_live_cells / num_samples ) {
+    samples.push_back( &*it->genome );
+  }
+
+  return dish2::reduce_parallel(
+    std::begin( samples ), std::end( samples ),
+    []( const auto first, const auto last ){
+      double res{};
+      for ( auto it = first; it != last; ++it ) {
+        res += dish2::measure_serialized_compression_ratio( **it );
+      }
+      return res;
+    },
+    []( double& accumulator, const double partial ){
+      accumulator += partial;
+    },
+    num_threads
+  ) / num_samples;
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_INTROSPECTION_GET_MEAN_GENOME_COMPRESSION_RATIO_PARALLEL_HPP_INCLUDE
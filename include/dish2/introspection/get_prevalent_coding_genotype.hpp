@@ -4,7 +4,7 @@
 
 #include <algorithm>
 #include <limits>
-#include <map>
+#include <unordered_map>
 #include <utility>
 
 #include "../../../third-party/Empirical/include/emp/base/assert.hpp"
@@ -12,6 +12,7 @@
 #include "../../../third-party/signalgp-lite/include/sgpl/introspection/count_modules.hpp"
 
 #include "../cell/Cell.hpp"
+#include "../genome/CodingGenotypeHash.hpp"
 #include "../genome/Genome.hpp"
 #include "../world/iterators/CodingGenotypeConstWrapper.hpp"
 #include "../world/iterators/LiveCellIterator.hpp"
@@ -46,14 +47,20 @@ get_prevalent_coding_genotype( const dish2::ThreadWorld<Spec>& world ) {
   using wrapper_t = internal::get_prevalent_coding_genotype::wrapper_t<Spec>;
   using coding_genotype_ref_t = typename wrapper_t::value_type;
 
-  // coding_genotype_ref_t -> count
-  std::map< coding_genotype_ref_t, size_t > counter;
-
-  std::for_each(
-    wrapper_t{ dish2::LiveCellIterator<Spec>::make_begin( population ) },
-    wrapper_t{ dish2::LiveCellIterator<Spec>::make_end( population ) },
-    [&counter]( const auto& coding_genotype ){ ++counter[ coding_genotype ]; }
-  );
+  // coding genotype hash -> count and first cell with that genotype
+  std::unordered_map<
+    dish2::CodingGenotypeHash,
+    std::pair< size_t, dish2::LiveCellIterator<Spec> >
+  > counter;
+  counter.reserve( population.size() );
+
+  for (
+    auto it = dish2::LiveCellIterator<Spec>::make_begin( population );
+    it != dish2::LiveCellIterator<Spec>::make_end( population );
+    ++it
+  ) ++counter.try_emplace(
+    it->genome->GetCodingGenotypeHash(), 0, it
+  ).first->second.first;
 
   const static dish2::Genome<Spec> blank_dummy{};
   if ( counter.empty() ) {
@@ -62,15 +69,21 @@ get_prevalent_coding_genotype( const dish2::ThreadWorld<Spec>& world ) {
       coding_genotype_ref_t{ blank_dummy.event_tags, blank_dummy.program },
       0
     };
-  } else return *std::max_element(
+  }
+
+  const auto& [count, representative] = std::max_element(
     std::begin( counter ),
     std::end( counter ),
     []( const auto& left, const auto& right ) {
-      const auto& [left_genotype, left_count] = left;
-      const auto& [right_genotype, right_count] = right;
-      return left_count < right_count;
+      const auto& [left_hash, left_entry] = left;
+      const auto& [right_hash, right_entry] = right;
+      // break ties by hash for a deterministic choice
+      return std::pair{ left_entry.first, right_hash }
+        < std::pair{ right_entry.first, left_hash };
     }
-  );
+  )->second;
+
+  return std::pair{ *wrapper_t{ representative }, count };
 
 }
 
@@ -0,0 +1,49 @@
+#pragma once
+#ifndef DISH2_INTROSPECTION_GET_ROOT_ID_RANGE_HPP_INCLUDE
+#define DISH2_INTROSPECTION_GET_ROOT_ID_RANGE_HPP_INCLUDE
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "../phylogeny/RootAbundanceTable.hpp"
+#include "../world/iterators/LiveCellIterator.hpp"
+#include "../world/iterators/RootIDValWrapper.hpp"
+#include "../world/ThreadWorld.hpp"
+
+namespace dish2 {
+
+/// @return smallest and largest root ID among live cells, or an empty range
+/// (first greater than second) if there are no live cells.
+template< typename Spec >
+std::pair< size_t, size_t > get_root_id_range(
+  const dish2::ThreadWorld<Spec>& world
+) {
+
+  std::pair< size_t, size_t > res{ std::numeric_limits<size_t>::max(), 0 };
+
+  const auto update = [&res]( const size_t root_id ){
+    res.first = std::min( res.first, root_id );
+    res.second = std::max( res.second, root_id );
+  };
+
+  const auto& table = dish2::RootAbundanceTable::Get();
+  if ( table.IsOpenFor( world ) ) {
+    for ( const auto& [root_id, count] : table.GetCounts() ) update( root_id );
+  } else {
+    using lcit_t = dish2::LiveCellIterator<Spec>;
+    using wrapper_t = dish2::RootIDValWrapper<lcit_t>;
+    std::for_each(
+      wrapper_t{ lcit_t::make_begin( world.population ) },
+      wrapper_t{ lcit_t::make_end( world.population ) },
+      update
+    );
+  }
+
+  return res;
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_INTROSPECTION_GET_ROOT_ID_RANGE_HPP_INCLUDE
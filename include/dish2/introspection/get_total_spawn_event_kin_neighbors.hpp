@@ -2,13 +2,7 @@
 #ifndef DISH2_INTROSPECTION_GET_TOTAL_SPAWN_EVENT_KIN_NEIGHBORS_HPP_INCLUDE
 #define DISH2_INTROSPECTION_GET_TOTAL_SPAWN_EVENT_KIN_NEIGHBORS_HPP_INCLUDE
 
-#include <algorithm>
-#include <iterator>
-
-#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
-
 #include "../runninglog/SpawnEvent.hpp"
-#include "../world/iterators/LogIteratorAdapter.hpp"
 #include "../world/ThreadWorld.hpp"
 
 namespace dish2 {
@@ -18,27 +12,9 @@ size_t get_total_spawn_event_kin_neighbors(
   const dish2::ThreadWorld<Spec>& world, const size_t lev
 ) {
 
-  const auto& population = world.population;
-
-  using iterator_t = dish2::LogIteratorAdapter<
-    dish2::SpawnEvent<Spec>,
-    decltype( std::begin(population) )
-  >;
-
-  const auto [begin, end] = iterator_t::make(
-    std::begin( population ), std::end( population )
-  );
-
-  return std::accumulate(
-    begin, end, 0,
-    [=]( const size_t accumulator, const auto& event ){
-      const size_t peripherality = event.peripherality_parent[lev];
-      emp_assert( event.num_neighbors_parent >= peripherality );
-      const size_t num_kin_neighbors
-        = event.num_neighbors_parent - peripherality;
-      return accumulator + num_kin_neighbors;
-    }
-  );
+  return world.template GetRunningLogSummary<
+    dish2::SpawnEvent<Spec>
+  >().GetNumKinNeighbors( lev );
 
 }
 
@@ -49,27 +25,9 @@ size_t get_total_spawn_event_kin_neighbors(
   const size_t replev
 ) {
 
-  const auto& population = world.population;
-
-  using iterator_t = dish2::LogIteratorAdapter<
-    dish2::SpawnEvent<Spec>,
-    decltype( std::begin(population) )
-  >;
-
-  const auto [begin, end] = iterator_t::make(
-    std::begin( population ), std::end( population )
-  );
-
-  return std::accumulate(
-    begin, end, 0,
-    [=]( const size_t accumulator, const auto& event ){
-      const size_t peripherality = event.peripherality_parent[lev];
-      emp_assert( event.num_neighbors_parent >= peripherality );
-      const size_t num_kin_neighbors
-        = event.num_neighbors_parent - peripherality;
-      return accumulator + num_kin_neighbors * (event.replev == replev);
-    }
-  );
+  return world.template GetRunningLogSummary<
+    dish2::SpawnEvent<Spec>
+  >().GetNumKinNeighbors( lev, replev );
 
 }
 
@@ -6,6 +6,7 @@
 #include <iterator>
 
 #include "../cell/Cell.hpp"
+#include "../phylogeny/RootAbundanceTable.hpp"
 #include "../world/iterators/LiveCellIterator.hpp"
 #include "../world/ThreadWorld.hpp"
 
@@ -18,7 +19,9 @@ bool has_coalesced( const dish2::ThreadWorld<Spec>& world ) {
 
   const auto& population = world.population;
 
-  if ( dish2::no_live_cells<Spec>( world ) ) return true;
+  const auto& table = dish2::RootAbundanceTable::Get();
+  if ( table.IsOpenFor( world ) ) return table.GetNumRoots() <= 1;
+  else if ( dish2::no_live_cells<Spec>( world ) ) return true;
   else {
     const auto begin = dish2::LiveCellIterator<Spec>::make_begin(
       population
@@ -2,53 +2,32 @@
 #ifndef DISH2_INTROSPECTION_SUMMARIZE_MODULE_EXPRESSION_HPP_INCLUDE
 #define DISH2_INTROSPECTION_SUMMARIZE_MODULE_EXPRESSION_HPP_INCLUDE
 
-#include <algorithm>
-
 #include "../../../third-party/header-only-pca/include/hopca/types.hpp"
 #include "../../../third-party/signalgp-lite/include/sgpl/introspection/summarize_module_expression.hpp"
 
 #include "../world/ThreadWorld.hpp"
 
-#include "count_live_cardinals.hpp"
-#include "get_maximum_module_count.hpp"
+#include "build_module_summary_matrix.hpp"
 
 namespace dish2 {
 
+/// @return matrix with a row for each live cardinal and a column for each
+/// module, zero padded to the largest program's module count.
+/// @param num_threads maximum number of threads, or 0 to use hardware
+/// concurrency.
 template< typename Spec >
 hopca::Matrix summarize_module_expression(
-  const dish2::ThreadWorld< Spec >& world
+  const dish2::ThreadWorld< Spec >& world, const size_t num_threads=1
 ) {
 
-  const size_t max_modules = dish2::get_maximum_module_count<Spec>( world );
-  const size_t num_live_cardinals = dish2::count_live_cardinals<Spec>( world );
-  const auto& population = world.population;
-
-  emp::vector<double> res;
-
-  std::for_each(
-    dish2::LiveCellIterator<Spec>::make_begin( population ),
-    dish2::LiveCellIterator<Spec>::make_end( population ),
-    [&]( const auto& cell ){ for (const auto& cardinal : cell) {
-
-      auto cardinal_module_expression = sgpl::summarize_module_expression(
-        cardinal.cpu,
-        cell.genome->program
-      );
-
-      // pad with zeros if necessary
-      cardinal_module_expression.resize( max_modules );
-
-      std::copy(
-        std::begin( cardinal_module_expression ),
-        std::end( cardinal_module_expression ),
-        std::back_inserter( res )
-      );
-
-    } }
+  return dish2::build_module_summary_matrix< Spec >(
+    world,
+    num_threads,
+    []( const auto& cpu, const auto& program ){
+      return sgpl::summarize_module_expression( cpu, program );
+    }
   );
 
-  return hola::matrix_from_array( res.data(), num_live_cardinals, max_modules );
-
 }
 
 } // namespace dish2
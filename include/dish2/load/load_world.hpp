@@ -5,6 +5,7 @@
 #include "innoculate_population.hpp"
 #include "monoculture_population.hpp"
 #include "reconstitute_population.hpp"
+#include "restore_checkpoint.hpp"
 
 namespace dish2 {
 
@@ -19,6 +20,8 @@ void load_world(
     dish2::monoculture_population( 0, thread_world );
   else if ( cfg.GENESIS() == "reconstitute" )
     dish2::reconstitute_population( 0, thread_world );
+  else if ( cfg.GENESIS() == "checkpoint" )
+    dish2::restore_checkpoint( thread_idx, thread_world );
   else emp_always_assert( cfg.GENESIS() == "generate", cfg.GENESIS() );
 
 }
@@ -15,7 +15,10 @@
 #include "../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 
 #include "../algorithm/seed_genomes_into.hpp"
+#include "../archive/PopulationArchiveReader.hpp"
+#include "../config/cfg.hpp"
 #include "../genome/Genome.hpp"
+#include "../record/make_filename/make_population_extension.hpp"
 #include "../world/ThreadWorld.hpp"
 
 namespace dish2 {
@@ -34,7 +37,7 @@ void reconstitute_population(
       {"a", "population"},
       {"proc", emp::to_string( uitsl::get_proc_id() )},
       {"thread", emp::to_string( thread_idx )},
-      {"ext", ".bin.xz"}
+      {"ext", dish2::make_population_extension()}
     });
 
     emp_always_assert(
@@ -42,9 +45,15 @@ void reconstitute_population(
       eligible_population_paths.size(), eligible_population_paths
     );
 
-    bxz::ifstream ifs( eligible_population_paths.front() );
-    cereal::BinaryInputArchive iarchive( ifs );
-    iarchive( reconstituted );
+    if ( cfg.POPULATION_ARCHIVE() ) {
+      reconstituted = dish2::PopulationArchiveReader<Spec>(
+        eligible_population_paths.front()
+      ).GetGenomes();
+    } else {
+      bxz::ifstream ifs( eligible_population_paths.front() );
+      cereal::BinaryInputArchive iarchive( ifs );
+      iarchive( reconstituted );
+    }
 
     std::cout << "proc " << uitsl::get_proc_id() << " thread " << thread_idx
       << " reconstituted " << reconstituted.size() << " cells from "
@@ -0,0 +1,110 @@
+#pragma once
+#ifndef DISH2_LOAD_RESTORE_CHECKPOINT_HPP_INCLUDE
+#define DISH2_LOAD_RESTORE_CHECKPOINT_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+
+#include <mpi.h>
+
+#include "../../../third-party/bxzstr/include/bxzstr.hpp"
+#include "../../../third-party/cereal/include/cereal/archives/binary.hpp"
+#include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
+#include "../../../third-party/conduit/include/uitsl/polyfill/filesystem.hpp"
+#include "../../../third-party/conduit/include/uitsl/utility/keyname_directory_filter.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/tools/keyname_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../parallel/GlobalAllreduce.hpp"
+#include "../world/serialize_checkpoint.hpp"
+#include "../world/ThreadWorld.hpp"
+
+namespace dish2 {
+
+/// Restore thread world from a checkpoint dumped by a run with identical
+/// process, thread, and population configuration.
+/// All threads of all processes restore the most recent update for which
+/// every one of them has a checkpoint.
+/// CPU cores start fresh from each restored genome's program.
+/// Collective: every simulation thread of every process must call.
+template< typename Spec >
+void restore_checkpoint(
+  const size_t thread_idx, dish2::ThreadWorld<Spec>& world
+) {
+
+  const auto eligible_checkpoint_paths = uitsl::keyname_directory_filter({
+    {"a", "checkpoint"},
+    {"proc", emp::to_string( uitsl::get_proc_id() )},
+    {"thread", emp::to_string( thread_idx )}
+  });
+
+  emp_always_assert(
+    eligible_checkpoint_paths.size(),
+    "no checkpoint found", uitsl::get_proc_id(), thread_idx
+  );
+
+  const auto get_update = []( const auto& path ){
+    return emp::from_string< uint64_t >( emp::keyname::unpack(
+      std::filesystem::path( path ).filename().string()
+    ).at( "update" ) );
+  };
+
+  // most recent checkpoint of this thread at or before update,
+  // or end if none
+  const auto find_latest = [&]( const uint64_t update ){
+    auto res = std::end( eligible_checkpoint_paths );
+    for (
+      auto it = std::begin( eligible_checkpoint_paths );
+      it != std::end( eligible_checkpoint_paths );
+      ++it
+    ) if (
+      get_update( *it ) <= update
+      && ( res == std::end( eligible_checkpoint_paths )
+        || get_update( *res ) < get_update( *it ) )
+    ) res = it;
+    return res;
+  };
+
+  static dish2::GlobalAllreduce< uint64_t > reduce(
+    MPI_UINT64_T, MPI_MIN,
+    []( const uint64_t a, const uint64_t b ){ return std::min( a, b ); }
+  );
+
+  // lower candidate update to each thread's latest checkpoint at or before
+  // it until all threads agree, which they all observe in the same round
+  uint64_t candidate = std::numeric_limits< uint64_t >::max();
+  while ( true ) {
+    const auto latest = find_latest( candidate );
+    emp_always_assert(
+      latest != std::end( eligible_checkpoint_paths ),
+      "no checkpoint common to all threads", uitsl::get_proc_id(), thread_idx
+    );
+    const uint64_t agreed = reduce( { get_update( *latest ) } ).front();
+    if ( agreed == candidate ) break;
+    candidate = agreed;
+  }
+
+  const auto checkpoint_path = *find_latest( candidate );
+  emp_always_assert( get_update( checkpoint_path ) == candidate );
+
+  {
+    // codec is detected from file contents
+    bxz::ifstream ifs( checkpoint_path );
+    cereal::BinaryInputArchive iarchive( ifs );
+    dish2::serialize_checkpoint( iarchive, world );
+  }
+
+  dish2::reset_checkpoint_cpus( world );
+
+  std::cout << "proc " << uitsl::get_proc_id() << " thread " << thread_idx
+    << " restored checkpoint at update " << world.GetUpdate() << " from "
+    << checkpoint_path << std::endl;
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_LOAD_RESTORE_CHECKPOINT_HPP_INCLUDE
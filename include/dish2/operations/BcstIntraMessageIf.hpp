@@ -11,6 +11,8 @@
 #include "../../../third-party/signalgp-lite/include/sgpl/program/Instruction.hpp"
 #include "../../../third-party/signalgp-lite/include/sgpl/program/Program.hpp"
 
+#include "../debug/tally_put.hpp"
+
 namespace dish2 {
 
 struct BcstIntraMessageIf {
@@ -26,7 +28,7 @@ struct BcstIntraMessageIf {
     if ( !core.registers[ inst.args[0] ] ) return;
 
     for ( auto& out : peripheral.intra_message_node_outputs ) {
-      out.TryPut( std::make_tuple(
+      dish2::tally_put( out, std::make_tuple(
         inst.tag, core.GetRegisters()
       ) );
     }
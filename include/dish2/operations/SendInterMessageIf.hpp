@@ -11,6 +11,8 @@
 #include "../../../third-party/signalgp-lite/include/sgpl/program/Instruction.hpp"
 #include "../../../third-party/signalgp-lite/include/sgpl/program/Program.hpp"
 
+#include "../debug/tally_put.hpp"
+
 namespace dish2 {
 
 struct SendInterMessageIf {
@@ -25,7 +27,7 @@ struct SendInterMessageIf {
 
     if ( !core.registers[ inst.args[0] ] ) return;
 
-    peripheral.message_node_output.TryPut( std::make_tuple(
+    dish2::tally_put( peripheral.message_node_output, std::make_tuple(
       inst.tag, core.GetRegisters()
     ) );
 
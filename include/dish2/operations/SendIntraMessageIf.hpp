@@ -10,6 +10,8 @@
 #include "../../../third-party/signalgp-lite/include/sgpl/program/Instruction.hpp"
 #include "../../../third-party/signalgp-lite/include/sgpl/program/Program.hpp"
 
+#include "../debug/tally_put.hpp"
+
 namespace dish2 {
 
 struct SendIntraMessageIf {
@@ -33,7 +35,7 @@ struct SendIntraMessageIf {
       0
     ) % num_addrs;
 
-    outputs[ addr ].TryPut( std::make_tuple(
+    dish2::tally_put( outputs[ addr ], std::make_tuple(
       inst.tag, core.GetRegisters()
     ) );
 
@@ -0,0 +1,65 @@
+#pragma once
+#ifndef DISH2_PARALLEL_ADAPTIVECAPACITY_HPP_INCLUDE
+#define DISH2_PARALLEL_ADAPTIVECAPACITY_HPP_INCLUDE
+
+#include <algorithm>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+namespace dish2 {
+
+/// Chooses a buffer capacity from observed put outcomes.
+/// Over each window of puts, doubles capacity if any put dropped and halves
+/// it if peak occupancy stayed at or below a quarter of capacity.
+/// Capacity is kept a power-of-two multiple of the minimum, within bounds.
+class AdaptiveCapacity {
+
+  size_t min_capacity;
+  size_t max_capacity;
+  size_t capacity;
+
+  size_t window_puts{};
+  size_t window_drops{};
+  size_t window_peak_occupancy{};
+
+  static constexpr size_t window_length = 64;
+
+public:
+
+  AdaptiveCapacity(const size_t min_capacity_, const size_t max_capacity_)
+  : min_capacity( min_capacity_ )
+  , max_capacity( std::max( min_capacity_, max_capacity_ ) )
+  , capacity( min_capacity_ )
+  { emp_assert( min_capacity ); }
+
+  /// Record put outcome and buffer occupancy observed at put time.
+  /// @return whether a new capacity is desired at window end.
+  bool Record( const bool success, const size_t occupancy ) {
+    ++window_puts;
+    window_drops += !success;
+    window_peak_occupancy = std::max( window_peak_occupancy, occupancy );
+
+    if ( window_puts < window_length ) return false;
+
+    const size_t prev = capacity;
+    if ( window_drops && capacity * 2 <= max_capacity ) capacity *= 2;
+    else if (
+      !window_drops
+      && window_peak_occupancy * 4 <= capacity
+      && capacity / 2 >= min_capacity
+    ) capacity /= 2;
+
+    window_puts = 0;
+    window_drops = 0;
+    window_peak_occupancy = 0;
+
+    return capacity != prev;
+  }
+
+  size_t GetCapacity() const { return capacity; }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_ADAPTIVECAPACITY_HPP_INCLUDE
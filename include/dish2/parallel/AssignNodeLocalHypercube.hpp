@@ -0,0 +1,126 @@
+#pragma once
+#ifndef DISH2_PARALLEL_ASSIGNNODELOCALHYPERCUBE_HPP_INCLUDE
+#define DISH2_PARALLEL_ASSIGNNODELOCALHYPERCUBE_HPP_INCLUDE
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+
+#include "../../../third-party/conduit/include/uitsl/debug/safe_cast.hpp"
+#include "../../../third-party/conduit/include/uitsl/polyfill/identity.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../third-party/signalgp-lite/include/sgpl/utility/CountingIterator.hpp"
+
+namespace dish2 {
+
+/// Wraps a perfect hypercube block assignment so that blocks that are
+/// adjacent on the toroidal grid are placed on processes that share a node.
+/// Blocks are ordered along a Z-order (Morton) curve through block
+/// coordinates, then dealt out to processes grouped by node.
+template< typename RETURN_TYPE >
+class AssignNodeLocalHypercube {
+
+  // block id -> assigned proc
+  emp::vector< RETURN_TYPE > remap;
+
+  std::function< RETURN_TYPE(size_t) > base;
+
+  static size_t calc_morton_code( const emp::vector< size_t >& coords ) {
+
+    const size_t bits_per_dim
+      = std::numeric_limits<size_t>::digits / coords.size();
+
+    size_t res{};
+    for (size_t bit{}; bit < bits_per_dim; ++bit) {
+      for (size_t dim{}; dim < coords.size(); ++dim) {
+        res |= ( (coords[dim] >> bit) & 1 ) << (bit * coords.size() + dim);
+      }
+    }
+    return res;
+
+  }
+
+public:
+
+  /// @param base_ assigns cell index to block id in [0, node_ids_.size()).
+  /// @param dims extent of each dimension of the toroidal grid, in cells.
+  /// @param node_ids_ node ID of each process, indexed by proc.
+  AssignNodeLocalHypercube(
+    const std::function< RETURN_TYPE(size_t) >& base_,
+    const emp::vector< size_t >& dims,
+    const emp::vector< int >& node_ids_
+  ) : remap( node_ids_.size() )
+  , base( base_ ) {
+
+    const size_t num_blocks = node_ids_.size();
+    const size_t num_cells = std::accumulate(
+      std::begin( dims ), std::end( dims ), size_t{1}, std::multiplies{}
+    );
+
+    const size_t blocks_per_dim = std::round(
+      std::pow( num_blocks, 1.0 / dims.size() )
+    );
+
+    // find block coordinates from the first (i.e., lowest-coordinate) cell
+    // assigned to each block
+    emp::vector< size_t > block_morton_codes( num_blocks );
+    emp::vector< bool > block_seen( num_blocks );
+    for (size_t cell{}; cell < num_cells; ++cell) {
+      const size_t block = uitsl::safe_cast<size_t>( base( cell ) );
+      emp_assert( block < num_blocks, block, num_blocks );
+      if ( block_seen[ block ] ) continue;
+      block_seen[ block ] = true;
+
+      emp::vector< size_t > block_coords( dims.size() );
+      size_t remainder = cell;
+      for (size_t dim{}; dim < dims.size(); ++dim) {
+        const size_t block_width = dims[dim] / blocks_per_dim;
+        block_coords[dim] = ( remainder % dims[dim] ) / block_width;
+        remainder /= dims[dim];
+      }
+      block_morton_codes[ block ] = calc_morton_code( block_coords );
+    }
+
+    emp_assert( std::all_of(
+      std::begin( block_seen ), std::end( block_seen ), std::identity
+    ) );
+
+    emp::vector< size_t > block_order(
+      sgpl::CountingIterator{}, sgpl::CountingIterator{ num_blocks }
+    );
+    std::stable_sort(
+      std::begin( block_order ), std::end( block_order ),
+      [&block_morton_codes]( const size_t l, const size_t r ){
+        return block_morton_codes[l] < block_morton_codes[r];
+      }
+    );
+
+    // procs grouped by node, keeping MPI_COMM_WORLD order within each node
+    emp::vector< size_t > proc_order(
+      sgpl::CountingIterator{}, sgpl::CountingIterator{ num_blocks }
+    );
+    std::stable_sort(
+      std::begin( proc_order ), std::end( proc_order ),
+      [&node_ids_]( const size_t l, const size_t r ){
+        return node_ids_[l] < node_ids_[r];
+      }
+    );
+
+    for (size_t i{}; i < num_blocks; ++i) {
+      remap[ block_order[i] ] = uitsl::safe_cast<RETURN_TYPE>( proc_order[i] );
+    }
+
+  }
+
+  RETURN_TYPE operator()( const size_t cell ) const {
+    return remap[ base( cell ) ];
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_ASSIGNNODELOCALHYPERCUBE_HPP_INCLUDE
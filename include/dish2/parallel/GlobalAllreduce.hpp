@@ -0,0 +1,104 @@
+#pragma once
+#ifndef DISH2_PARALLEL_GLOBALALLREDUCE_HPP_INCLUDE
+#define DISH2_PARALLEL_GLOBALALLREDUCE_HPP_INCLUDE
+
+#include <algorithm>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+#include <mpi.h>
+
+#include "../../../third-party/conduit/include/uitsl/mpi/audited_routines.hpp"
+#include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../config/cfg.hpp"
+
+namespace dish2 {
+
+/// Elementwise reduction of a buffer contributed by every simulation thread of
+/// every process.
+/// Threads of a process combine contributions under a lock, then the last
+/// thread to arrive reduces across processes with one `MPI_Allreduce` on
+/// behalf of all of them.
+/// Collective: every simulation thread of every process must call with the
+/// same buffer length, in the same order relative to other collectives.
+/// Each call site should own its own instance.
+template< typename T >
+class GlobalAllreduce {
+
+  using combine_t = std::function< T( const T&, const T& ) >;
+
+  const MPI_Datatype datatype;
+  const MPI_Op op;
+  // must agree with op
+  const combine_t combine;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t generation{};
+  size_t num_arrived{};
+
+  emp::vector< T > buffer;
+  emp::vector< T > result;
+
+public:
+
+  /// @param combine thread-level equivalent of op.
+  GlobalAllreduce(
+    const MPI_Datatype datatype_, const MPI_Op op_, combine_t combine_
+  ) : datatype( datatype_ )
+  , op( op_ )
+  , combine( std::move( combine_ ) )
+  { }
+
+  /// @return contributions reduced across all threads and processes.
+  emp::vector< T > operator()( const emp::vector< T >& contribution ) {
+
+    std::unique_lock lock( mutex );
+
+    if ( num_arrived == 0 ) buffer = contribution;
+    else {
+      emp_assert( buffer.size() == contribution.size() );
+      std::transform(
+        std::begin( buffer ), std::end( buffer ),
+        std::begin( contribution ),
+        std::begin( buffer ),
+        combine
+      );
+    }
+
+    if ( ++num_arrived == dish2::cfg.N_THREADS() ) {
+
+      result.resize( buffer.size() );
+      if ( uitsl::is_multiprocess() ) UITSL_Allreduce(
+        buffer.data(), // const void *sendbuf
+        result.data(), // void *recvbuf
+        buffer.size(), // int count
+        datatype, // MPI_Datatype datatype
+        op, // MPI_Op op
+        MPI_COMM_WORLD // MPI_Comm comm
+      ); else result = buffer;
+
+      num_arrived = 0;
+      ++generation;
+      cv.notify_all();
+
+    } else {
+      const size_t cur_generation = generation;
+      cv.wait( lock, [this, cur_generation](){
+        return generation != cur_generation;
+      } );
+    }
+
+    return result;
+
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_GLOBALALLREDUCE_HPP_INCLUDE
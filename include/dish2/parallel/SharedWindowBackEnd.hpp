@@ -0,0 +1,152 @@
+#pragma once
+#ifndef DISH2_PARALLEL_SHAREDWINDOWBACKEND_HPP_INCLUDE
+#define DISH2_PARALLEL_SHAREDWINDOWBACKEND_HPP_INCLUDE
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+#include <mpi.h>
+
+#include "../../../third-party/conduit/include/uitsl/mpi/audited_routines.hpp"
+#include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "../config/cfg.hpp"
+
+#include "get_node_comm.hpp"
+#include "get_node_rank.hpp"
+
+namespace dish2 {
+
+/// Owns an MPI shared memory window holding a table of `Slot`s for each
+/// process on the node.
+/// Each same-node duct claims a slot in its outlet process' table, keyed by
+/// inlet proc and tag, so both ends find the same slot without communicating.
+/// Slots reserve ring storage for `BaseCapacity` values, or
+/// `DUCT_ADAPTIVE_CAPACITY_MAX_FACTOR` times that if `DUCT_ADAPTIVE_CAPACITY`
+/// is set.
+/// Also owns the back end of the delegate duct used for off-node edges.
+template< typename Slot, typename DelegateBackEnd, size_t BaseCapacity >
+class SharedWindowBackEnd {
+
+  std::shared_ptr< DelegateBackEnd > delegate{
+    std::make_shared< DelegateBackEnd >()
+  };
+
+  const size_t num_slots{ dish2::cfg.SHARED_WINDOW_DUCT_SLOTS() };
+
+  const size_t max_capacity{
+    dish2::cfg.DUCT_ADAPTIVE_CAPACITY()
+      ? BaseCapacity * dish2::cfg.DUCT_ADAPTIVE_CAPACITY_MAX_FACTOR()
+      : BaseCapacity
+  };
+
+  // must agree across processes on node, as must max_capacity
+  const size_t stride{ Slot::GetStride( max_capacity ) };
+
+  MPI_Win window{ MPI_WIN_NULL };
+
+  static uint64_t MakeKey( const uitsl::proc_id_t inlet_proc, const int tag ) {
+    constexpr size_t tag_bits = 40;
+    emp_assert( static_cast<uint64_t>( tag ) < ( uint64_t{1} << tag_bits ) );
+    // add one so that key is never zero, which indicates unclaimed
+    return (
+      ( static_cast<uint64_t>( inlet_proc ) << tag_bits )
+      | static_cast<uint64_t>( tag )
+    ) + 1;
+  }
+
+public:
+
+  /// Collective across all processes on node.
+  SharedWindowBackEnd() {
+
+    if ( !IsEnabled() ) return;
+
+    emp_always_assert( max_capacity >= BaseCapacity, max_capacity );
+
+    std::byte* local_table;
+    UITSL_Win_allocate_shared(
+      num_slots * stride, // MPI_Aint size
+      1, // int disp_unit
+      MPI_INFO_NULL, // MPI_Info info
+      dish2::get_node_comm(), // MPI_Comm comm
+      &local_table, // void *baseptr
+      &window // MPI_Win *win
+    );
+
+    // each process sets up its own table
+    for (size_t i{}; i < num_slots; ++i) {
+      new ( local_table + i * stride ) Slot( max_capacity );
+    }
+
+    // passive target epoch for the life of the window;
+    // ordering between processes is then handled by slot atomics
+    UITSL_Win_lock_all( MPI_MODE_NOCHECK, window );
+    UITSL_Win_sync( window );
+    UITSL_Barrier( dish2::get_node_comm() );
+
+  }
+
+  ~SharedWindowBackEnd() {
+    if ( window == MPI_WIN_NULL ) return;
+    UITSL_Win_unlock_all( window );
+    UITSL_Win_free( &window );
+  }
+
+  SharedWindowBackEnd( const SharedWindowBackEnd& ) = delete;
+  SharedWindowBackEnd& operator=( const SharedWindowBackEnd& ) = delete;
+
+  bool IsEnabled() const { return num_slots && uitsl::is_multiprocess(); }
+
+  std::shared_ptr< DelegateBackEnd > GetDelegate() { return delegate; }
+
+  /// @return greatest capacity slots can be resized to.
+  size_t GetMaxCapacity() const { return max_capacity; }
+
+  /// Find slot for duct within outlet process' table, claiming it if
+  /// necessary.
+  Slot& Claim(
+    const uitsl::proc_id_t inlet_proc,
+    const uitsl::proc_id_t outlet_proc,
+    const int tag
+  ) {
+
+    emp_assert( IsEnabled() );
+
+    MPI_Aint size;
+    int disp_unit;
+    std::byte* table;
+    UITSL_Win_shared_query(
+      window, // MPI_Win win
+      dish2::get_node_rank( outlet_proc ), // int rank
+      &size, // MPI_Aint *size
+      &disp_unit, // int *disp_unit
+      &table // void *baseptr
+    );
+
+    // open addressing with linear probing
+    const uint64_t key = MakeKey( inlet_proc, tag );
+    for (size_t probe{}; probe < num_slots; ++probe) {
+      Slot& slot = *std::launder( reinterpret_cast< Slot* >(
+        table + ( (key + probe) % num_slots ) * stride
+      ) );
+      if ( slot.TryClaim( key ) ) return slot;
+    }
+
+    emp_always_assert( false,
+      "shared window duct slots exhausted, increase SHARED_WINDOW_DUCT_SLOTS",
+      num_slots
+    );
+    __builtin_unreachable();
+
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_SHAREDWINDOWBACKEND_HPP_INCLUDE
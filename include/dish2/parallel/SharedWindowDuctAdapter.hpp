@@ -0,0 +1,204 @@
+#pragma once
+#ifndef DISH2_PARALLEL_SHAREDWINDOWDUCTADAPTER_HPP_INCLUDE
+#define DISH2_PARALLEL_SHAREDWINDOWDUCTADAPTER_HPP_INCLUDE
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "../../../third-party/conduit/include/uit/setup/InterProcAddress.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/optional.hpp"
+#include "../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../config/cfg.hpp"
+
+#include "AdaptiveCapacity.hpp"
+#include "shares_node.hpp"
+#include "SharedWindowBackEnd.hpp"
+#include "SharedWindowSlot.hpp"
+
+namespace dish2 {
+
+/// Proc duct that, for each edge, uses a ring buffer in an MPI shared memory
+/// window if inlet and outlet processes share a node and otherwise falls back
+/// to `DelegateDuct`.
+/// Puts are dropping and value type must be trivially copyable.
+/// If `DUCT_ADAPTIVE_CAPACITY` is set, shared window ring capacity adapts to
+/// observed drops between `ImplSpec::N` and
+/// `DUCT_ADAPTIVE_CAPACITY_MAX_FACTOR` times that.
+///
+/// Usage: `dish2::SharedWindowDuctAdapter< uit::t::PooledIriObiDuct >::Duct`
+/// as the proc duct of a `uit::ImplSelect`.
+template< template<typename> typename DelegateDuct >
+struct SharedWindowDuctAdapter {
+
+template< typename ImplSpec >
+struct Duct {
+
+  using T = typename ImplSpec::T;
+  using delegate_t = DelegateDuct< ImplSpec >;
+  using slot_t = dish2::SharedWindowSlot< T >;
+
+  using BackEndImpl = dish2::SharedWindowBackEnd<
+    slot_t, typename delegate_t::BackEndImpl, ImplSpec::N
+  >;
+
+  class InletImpl {
+
+    emp::optional< typename delegate_t::InletImpl > delegate;
+    slot_t* slot{};
+
+    emp::optional< dish2::AdaptiveCapacity > adaptive_capacity;
+    bool resize_pending{};
+
+    bool TryPutSlot( const T& val ) {
+      if ( resize_pending ) resize_pending = !slot->TryResize(
+        adaptive_capacity->GetCapacity()
+      );
+
+      const size_t occupancy = slot->GetOccupancy();
+      const bool res = slot->TryPut( val );
+
+      if (
+        adaptive_capacity.has_value()
+        && adaptive_capacity->Record( res, occupancy + res )
+      ) resize_pending = true;
+
+      return res;
+    }
+
+  public:
+
+    template< typename... Args >
+    InletImpl(
+      const uit::InterProcAddress& address,
+      std::shared_ptr< BackEndImpl > back_end,
+      Args&&... args
+    ) {
+      if (
+        back_end->IsEnabled() && dish2::shares_node( address.GetOutletProc() )
+      ) {
+        slot = &back_end->Claim(
+          address.GetInletProc(), address.GetOutletProc(), address.GetTag()
+        );
+        if ( dish2::cfg.DUCT_ADAPTIVE_CAPACITY() ) {
+          adaptive_capacity.emplace(
+            ImplSpec::N, back_end->GetMaxCapacity()
+          );
+        }
+        resize_pending = !slot->TryResize(
+          adaptive_capacity.has_value()
+            ? adaptive_capacity->GetCapacity()
+            : ImplSpec::N
+        );
+      } else delegate.emplace(
+        address, back_end->GetDelegate(), std::forward<Args>( args )...
+      );
+    }
+
+    bool TryPut( const T& val ) {
+      return slot ? TryPutSlot( val ) : delegate->TryPut( val );
+    }
+
+    bool TryFlush() { return slot ? true : delegate->TryFlush(); }
+
+    size_t TryConsumeGets( size_t ) {
+      emp_always_assert( false,
+        "TryConsumeGets called on SharedWindowDuctAdapter inlet"
+      );
+      __builtin_unreachable();
+    }
+
+    const T& Get() const {
+      emp_always_assert( false,
+        "Get called on SharedWindowDuctAdapter inlet"
+      );
+      __builtin_unreachable();
+    }
+
+    T& Get() {
+      emp_always_assert( false,
+        "Get called on SharedWindowDuctAdapter inlet"
+      );
+      __builtin_unreachable();
+    }
+
+    static std::string GetName() { return "SharedWindowDuctAdapter inlet"; }
+
+    std::string ToString() const {
+      return slot
+        ? emp::to_string(
+          GetName(), " using shared window with capacity ",
+          slot->capacity.load( std::memory_order_relaxed )
+        )
+        : delegate->ToString();
+    }
+
+  };
+
+  class OutletImpl {
+
+    emp::optional< typename delegate_t::OutletImpl > delegate;
+    slot_t* slot{};
+    T cache{};
+
+  public:
+
+    template< typename... Args >
+    OutletImpl(
+      const uit::InterProcAddress& address,
+      std::shared_ptr< BackEndImpl > back_end,
+      Args&&... args
+    ) {
+      if (
+        back_end->IsEnabled() && dish2::shares_node( address.GetInletProc() )
+      ) slot = &back_end->Claim(
+        address.GetInletProc(), address.GetOutletProc(), address.GetTag()
+      );
+      else delegate.emplace(
+        address, back_end->GetDelegate(), std::forward<Args>( args )...
+      );
+    }
+
+    bool TryPut( const T& ) {
+      emp_always_assert( false,
+        "TryPut called on SharedWindowDuctAdapter outlet"
+      );
+      __builtin_unreachable();
+    }
+
+    bool TryFlush() {
+      emp_always_assert( false,
+        "TryFlush called on SharedWindowDuctAdapter outlet"
+      );
+      __builtin_unreachable();
+    }
+
+    size_t TryConsumeGets( const size_t requested ) {
+      return slot
+        ? slot->TryConsumeGets( requested, cache )
+        : delegate->TryConsumeGets( requested );
+    }
+
+    const T& Get() const { return slot ? cache : delegate->Get(); }
+
+    T& Get() { return slot ? cache : delegate->Get(); }
+
+    static std::string GetName() { return "SharedWindowDuctAdapter outlet"; }
+
+    std::string ToString() const {
+      return slot
+        ? emp::to_string( GetName(), " using shared window" )
+        : delegate->ToString();
+    }
+
+  };
+
+};
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_SHAREDWINDOWDUCTADAPTER_HPP_INCLUDE
@@ -0,0 +1,143 @@
+#pragma once
+#ifndef DISH2_PARALLEL_SHAREDWINDOWSLOT_HPP_INCLUDE
+#define DISH2_PARALLEL_SHAREDWINDOWSLOT_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+namespace dish2 {
+
+/// Single-producer, single-consumer ring buffer that lives in an MPI shared
+/// memory window.
+/// Puts drop when the ring is full.
+/// Capacity may be adjusted by the inlet between 1 and `max_capacity` while
+/// the ring is empty; storage beyond capacity is never touched, so its pages
+/// need not be committed.
+/// Ring storage trails the slot, so slots must be laid out `GetStride` bytes
+/// apart.
+/// Synchronization is through lock-free atomics, which are address-free and
+/// therefore valid across processes mapping the same memory.
+template< typename T >
+struct SharedWindowSlot {
+
+  static_assert( std::is_trivially_copyable_v< T > );
+  static_assert( std::atomic< uint64_t >::is_always_lock_free );
+  static_assert( std::atomic< size_t >::is_always_lock_free );
+
+  // zero indicates unclaimed
+  std::atomic< uint64_t > key{};
+
+  // written only by inlet, on its own cache line
+  alignas( 64 ) std::atomic< size_t > put_count{};
+
+  // written only by outlet, on its own cache line
+  alignas( 64 ) std::atomic< size_t > get_count{};
+
+  // fixed at construction
+  const size_t max_capacity;
+
+  // written only by inlet, and only while ring is empty
+  std::atomic< size_t > capacity;
+
+private:
+
+  static constexpr size_t GetBufferOffset() {
+    return ( sizeof( SharedWindowSlot ) + alignof( T ) - 1 )
+      / alignof( T ) * alignof( T );
+  }
+
+  // raw storage, so construction doesn't touch it
+  T* GetBuffer() {
+    return reinterpret_cast< T* >(
+      reinterpret_cast< std::byte* >( this ) + GetBufferOffset()
+    );
+  }
+
+public:
+
+  /// Construct in place at the start of `GetStride( max_capacity_ )` bytes.
+  explicit SharedWindowSlot( const size_t max_capacity_ )
+  : max_capacity( max_capacity_ )
+  , capacity( max_capacity_ )
+  { }
+
+  SharedWindowSlot( const SharedWindowSlot& ) = delete;
+  SharedWindowSlot& operator=( const SharedWindowSlot& ) = delete;
+
+  /// @return bytes occupied by a slot and its ring storage, rounded up so
+  /// that consecutive slots stay aligned.
+  static size_t GetStride( const size_t max_capacity ) {
+    constexpr size_t align = alignof( SharedWindowSlot );
+    static_assert( alignof( T ) <= align );
+    const size_t size = GetBufferOffset() + max_capacity * sizeof( T );
+    return ( size + align - 1 ) / align * align;
+  }
+
+  /// Claim slot for key, or verify it has been claimed for key already.
+  /// Either end of a duct may claim first.
+  bool TryClaim( const uint64_t claim_key ) {
+    uint64_t expected{};
+    return key.compare_exchange_strong( expected, claim_key )
+      || expected == claim_key;
+  }
+
+  /// Inlet only.
+  size_t GetOccupancy() const {
+    return put_count.load( std::memory_order_relaxed )
+      - get_count.load( std::memory_order_acquire );
+  }
+
+  /// Inlet only.
+  /// Set capacity if ring is empty.
+  /// @return whether capacity was set.
+  bool TryResize( const size_t new_capacity ) {
+    emp_assert(
+      new_capacity && new_capacity <= max_capacity, new_capacity
+    );
+    if ( GetOccupancy() ) return false;
+    // published to outlet by release of next put
+    capacity.store( new_capacity, std::memory_order_relaxed );
+    return true;
+  }
+
+  bool TryPut( const T& val ) {
+    const size_t cap = capacity.load( std::memory_order_relaxed );
+    const size_t put = put_count.load( std::memory_order_relaxed );
+    if ( put - get_count.load( std::memory_order_acquire ) >= cap ) return false;
+
+    std::memcpy( GetBuffer() + put % cap, &val, sizeof( T ) );
+    put_count.store( put + 1, std::memory_order_release );
+    return true;
+  }
+
+  /// Consume up to requested gets, copying the latest consumed into dest.
+  /// @return number gets consumed.
+  size_t TryConsumeGets( const size_t requested, T& dest ) {
+    const size_t get = get_count.load( std::memory_order_relaxed );
+    const size_t available
+      = put_count.load( std::memory_order_acquire ) - get;
+    const size_t num_consumed = std::min( requested, available );
+
+    if ( num_consumed ) {
+      // capacity can't change until all available gets are consumed
+      const size_t cap = capacity.load( std::memory_order_relaxed );
+      std::memcpy(
+        &dest, GetBuffer() + (get + num_consumed - 1) % cap, sizeof( T )
+      );
+      get_count.store( get + num_consumed, std::memory_order_release );
+    }
+
+    return num_consumed;
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_SHAREDWINDOWSLOT_HPP_INCLUDE
@@ -0,0 +1,67 @@
+#pragma once
+#ifndef DISH2_PARALLEL_THREADBUDGET_HPP_INCLUDE
+#define DISH2_PARALLEL_THREADBUDGET_HPP_INCLUDE
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+namespace dish2 {
+
+/// Counting semaphore bounding how many threads may do some kind of work at
+/// once, shared between independent callers.
+/// Work should be done while holding a `ThreadBudget::Lease`.
+class ThreadBudget {
+
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  const size_t num_threads;
+  size_t num_available;
+
+public:
+
+  /// Holds one thread's share of the budget until destruction.
+  class Lease {
+
+    ThreadBudget& budget;
+
+  public:
+
+    /// Blocks until budget is available.
+    explicit Lease( ThreadBudget& budget_ ) : budget( budget_ ) {
+      std::unique_lock lock( budget.mutex );
+      budget.cv.wait( lock, [this](){ return budget.num_available; } );
+      --budget.num_available;
+    }
+
+    ~Lease() {
+      {
+        const std::lock_guard guard( budget.mutex );
+        ++budget.num_available;
+      }
+      budget.cv.notify_one();
+    }
+
+    Lease( const Lease& ) = delete;
+    Lease& operator=( const Lease& ) = delete;
+
+  };
+
+  /// @param num_threads_ maximum number of leases held at once, at least
+  /// one.
+  explicit ThreadBudget( const size_t num_threads_ )
+  : num_threads( std::max< size_t >( num_threads_, 1 ) )
+  , num_available( num_threads )
+  { }
+
+  ThreadBudget( const ThreadBudget& ) = delete;
+  ThreadBudget& operator=( const ThreadBudget& ) = delete;
+
+  size_t GetNumThreads() const { return num_threads; }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_THREADBUDGET_HPP_INCLUDE
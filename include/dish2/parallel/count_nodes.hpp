@@ -0,0 +1,21 @@
+#pragma once
+#ifndef DISH2_PARALLEL_COUNT_NODES_HPP_INCLUDE
+#define DISH2_PARALLEL_COUNT_NODES_HPP_INCLUDE
+
+#include <set>
+
+#include "get_node_ids.hpp"
+
+namespace dish2 {
+
+size_t count_nodes() {
+
+  const auto& node_ids = dish2::get_node_ids();
+
+  return std::set< int >( std::begin( node_ids ), std::end( node_ids ) ).size();
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_COUNT_NODES_HPP_INCLUDE
@@ -0,0 +1,35 @@
+#pragma once
+#ifndef DISH2_PARALLEL_GET_NODE_COMM_HPP_INCLUDE
+#define DISH2_PARALLEL_GET_NODE_COMM_HPP_INCLUDE
+
+#include <mpi.h>
+
+#include "../../../third-party/conduit/include/uitsl/mpi/audited_routines.hpp"
+#include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
+
+namespace dish2 {
+
+/// @return communicator spanning all processes on the calling process' node,
+/// ranked in the same relative order as in MPI_COMM_WORLD.
+MPI_Comm get_node_comm() {
+
+  // split once, on first call, then reuse
+  static const MPI_Comm res = [](){
+    MPI_Comm comm;
+    UITSL_Comm_split_type(
+      MPI_COMM_WORLD, // MPI_Comm comm
+      MPI_COMM_TYPE_SHARED, // int split_type
+      uitsl::get_proc_id(), // int key
+      MPI_INFO_NULL, // MPI_Info info
+      &comm // MPI_Comm * newcomm
+    );
+    return comm;
+  }();
+
+  return res;
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_GET_NODE_COMM_HPP_INCLUDE
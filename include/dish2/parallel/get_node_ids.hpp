@@ -0,0 +1,55 @@
+#pragma once
+#ifndef DISH2_PARALLEL_GET_NODE_IDS_HPP_INCLUDE
+#define DISH2_PARALLEL_GET_NODE_IDS_HPP_INCLUDE
+
+#include <mpi.h>
+
+#include "../../../third-party/conduit/include/uitsl/mpi/audited_routines.hpp"
+#include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "get_node_comm.hpp"
+
+namespace dish2 {
+
+/// @return node ID of each process in MPI_COMM_WORLD, indexed by proc ID.
+/// A node's ID is the lowest MPI_COMM_WORLD rank among its processes.
+const emp::vector< int >& get_node_ids() {
+
+  // collective, so gather once on first call and then reuse
+  static const emp::vector< int > res = [](){
+
+    const int proc_id = uitsl::get_proc_id();
+
+    int node_id;
+    UITSL_Allreduce(
+      &proc_id, // const void *sendbuf
+      &node_id, // void *recvbuf
+      1, // int count
+      MPI_INT, // MPI_Datatype datatype
+      MPI_MIN, // MPI_Op op
+      dish2::get_node_comm() // MPI_Comm comm
+    );
+
+    emp::vector< int > node_ids( uitsl::get_nprocs() );
+    UITSL_Allgather(
+      &node_id, // const void *sendbuf
+      1, // int sendcount
+      MPI_INT, // MPI_Datatype sendtype
+      node_ids.data(), // void *recvbuf
+      1, // int recvcount
+      MPI_INT, // MPI_Datatype recvtype
+      MPI_COMM_WORLD // MPI_Comm comm
+    );
+
+    return node_ids;
+
+  }();
+
+  return res;
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_GET_NODE_IDS_HPP_INCLUDE
@@ -0,0 +1,48 @@
+#pragma once
+#ifndef DISH2_PARALLEL_GET_NODE_RANK_HPP_INCLUDE
+#define DISH2_PARALLEL_GET_NODE_RANK_HPP_INCLUDE
+
+#include <mpi.h>
+
+#include "../../../third-party/conduit/include/uitsl/mpi/audited_routines.hpp"
+#include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "get_node_comm.hpp"
+#include "shares_node.hpp"
+
+namespace dish2 {
+
+/// @return rank within node communicator of proc, which must share a node
+/// with the calling process.
+int get_node_rank( const uitsl::proc_id_t proc ) {
+
+  emp_assert( dish2::shares_node( proc ) );
+
+  MPI_Group world_group;
+  UITSL_Comm_group( MPI_COMM_WORLD, &world_group );
+
+  MPI_Group node_group;
+  UITSL_Comm_group( dish2::get_node_comm(), &node_group );
+
+  int res;
+  UITSL_Group_translate_ranks(
+    world_group, // MPI_Group group1
+    1, // int n
+    &proc, // const int ranks1[]
+    node_group, // MPI_Group group2
+    &res // int ranks2[]
+  );
+
+  UITSL_Group_free( &world_group );
+  UITSL_Group_free( &node_group );
+
+  emp_assert( res != MPI_UNDEFINED );
+
+  return res;
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_GET_NODE_RANK_HPP_INCLUDE
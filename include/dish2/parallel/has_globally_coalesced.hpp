@@ -0,0 +1,51 @@
+#pragma once
+#ifndef DISH2_PARALLEL_HAS_GLOBALLY_COALESCED_HPP_INCLUDE
+#define DISH2_PARALLEL_HAS_GLOBALLY_COALESCED_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstdint>
+
+#include <mpi.h>
+
+#include "../introspection/get_root_id_range.hpp"
+#include "../world/ThreadWorld.hpp"
+
+#include "GlobalAllreduce.hpp"
+
+namespace dish2 {
+
+/// Have live cells on every thread of every process descended from a single
+/// phylogenetic root?
+/// True if no live cells remain anywhere.
+/// Each thread contributes only the range of its live root IDs, which is
+/// reduced across threads and processes by `dish2::GlobalAllreduce`, so
+/// cost is independent of population size once `dish2::RootAbundanceTable`
+/// is open.
+/// Collective: every simulation thread of every process must call at the
+/// same update.
+template< typename Spec >
+bool has_globally_coalesced( const dish2::ThreadWorld<Spec>& world ) {
+
+  // smallest root ID and bitwise complement of largest root ID,
+  // so both reduce by minimum
+  static dish2::GlobalAllreduce< uint64_t > reduce(
+    MPI_UINT64_T, MPI_MIN,
+    []( const uint64_t a, const uint64_t b ){ return std::min( a, b ); }
+  );
+
+  const auto [min_root_id, max_root_id] = dish2::get_root_id_range<Spec>(
+    world
+  );
+
+  const auto bounds = reduce(
+    { uint64_t{ min_root_id }, ~uint64_t{ max_root_id } }
+  );
+
+  // ranges are empty (min > max) if there are no live cells
+  return bounds[0] >= ~bounds[1];
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_HAS_GLOBALLY_COALESCED_HPP_INCLUDE
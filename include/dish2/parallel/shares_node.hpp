@@ -0,0 +1,19 @@
+#pragma once
+#ifndef DISH2_PARALLEL_SHARES_NODE_HPP_INCLUDE
+#define DISH2_PARALLEL_SHARES_NODE_HPP_INCLUDE
+
+#include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
+
+#include "get_node_ids.hpp"
+
+namespace dish2 {
+
+/// @return whether proc shares a node with the calling process.
+bool shares_node( const uitsl::proc_id_t proc ) {
+  const auto& node_ids = dish2::get_node_ids();
+  return node_ids[ proc ] == node_ids[ uitsl::get_proc_id() ];
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PARALLEL_SHARES_NODE_HPP_INCLUDE
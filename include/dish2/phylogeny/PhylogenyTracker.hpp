@@ -0,0 +1,260 @@
+#pragma once
+#ifndef DISH2_PHYLOGENY_PHYLOGENYTRACKER_HPP_INCLUDE
+#define DISH2_PHYLOGENY_PHYLOGENYTRACKER_HPP_INCLUDE
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+#include "../../../third-party/cereal/include/cereal/cereal.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../config/cfg.hpp"
+#include "../genome/TaxonID.hpp"
+
+namespace dish2 {
+
+/// Genotype-level phylogeny of a thread's population, built as cells are
+/// born and die.
+/// A birth founds a new taxon if a mutation occurred or the parent taxon
+/// lives on another thread, and otherwise adds a member to the parent taxon.
+/// Extinct taxa with no descendant taxa are pruned after
+/// `PHYLOGENY_PRUNE_DELAY` updates without living members or spawn sends, so
+/// memory tracks the live lineages rather than the number of births.
+/// No-op unless opened with `PHYLOGENY_TRACKING` set.
+class PhylogenyTracker {
+
+public:
+
+  static constexpr uint32_t extant = std::numeric_limits<uint32_t>::max();
+
+  struct Taxon {
+
+    uint64_t id;
+    // zero if root
+    uint64_t parent_id;
+    uint32_t origin_update;
+    uint32_t extinction_update;
+    uint32_t num_living;
+    // number of descendant taxa not yet pruned
+    uint32_t num_children;
+    uint32_t num_spawns_sent;
+    // update of last birth, death, or spawn send
+    uint32_t last_activity_update;
+    // index of parent in taxa, or none if root or parent is on another thread
+    uint32_t parent_slot;
+
+    template <class Archive>
+    void serialize( Archive & ar ) { ar(
+      CEREAL_NVP( id ),
+      CEREAL_NVP( parent_id ),
+      CEREAL_NVP( origin_update ),
+      CEREAL_NVP( extinction_update ),
+      CEREAL_NVP( num_living ),
+      CEREAL_NVP( num_spawns_sent )
+    ); }
+
+  };
+
+private:
+
+  static constexpr uint32_t none = std::numeric_limits<uint32_t>::max();
+
+  // pruned slots are recycled through free_slots
+  emp::vector< Taxon > taxa;
+  emp::vector< uint32_t > free_slots;
+  std::unordered_map< uint64_t, uint32_t > slots_by_id;
+
+  // extinct leaf taxa awaiting pruning, as slot and id
+  std::deque< std::pair< uint32_t, uint64_t > > prune_queue;
+
+  bool open{ false };
+  uint32_t update{};
+
+  PhylogenyTracker() = default;
+
+  uint32_t FindSlot( const dish2::TaxonID taxon_id ) const {
+    const auto it = slots_by_id.find( taxon_id.GetID() );
+    return it == std::end( slots_by_id ) ? none : it->second;
+  }
+
+  dish2::TaxonID FoundTaxon(
+    const uint64_t parent_id, const uint32_t parent_slot
+  ) {
+    const dish2::TaxonID taxon_id{ std::in_place };
+
+    uint32_t slot;
+    if ( free_slots.size() ) {
+      slot = free_slots.back();
+      free_slots.pop_back();
+    } else {
+      slot = taxa.size();
+      taxa.emplace_back();
+    }
+
+    taxa[ slot ] = Taxon{
+      taxon_id.GetID(), parent_id, update, extant, 1, 0, 0, update, parent_slot
+    };
+    slots_by_id.emplace( taxon_id.GetID(), slot );
+
+    if ( parent_slot != none ) ++taxa[ parent_slot ].num_children;
+
+    return taxon_id;
+  }
+
+  bool IsPrunable( const Taxon& taxon ) const {
+    return taxon.num_living == 0
+      && taxon.num_children == 0
+      && update - taxon.last_activity_update
+        >= dish2::cfg.PHYLOGENY_PRUNE_DELAY();
+  }
+
+  // prune taxon and any ancestors it was keeping alive
+  void Prune( uint32_t slot ) {
+    while ( slot != none && IsPrunable( taxa[ slot ] ) ) {
+      const uint32_t parent_slot = taxa[ slot ].parent_slot;
+      slots_by_id.erase( taxa[ slot ].id );
+      free_slots.push_back( slot );
+
+      if ( parent_slot == none ) break;
+      auto& parent = taxa[ parent_slot ];
+      emp_assert( parent.num_children );
+      if ( --parent.num_children || parent.num_living ) break;
+      if ( !IsPrunable( parent ) ) {
+        // wait out parent's own delay
+        prune_queue.emplace_back( parent_slot, parent.id );
+        break;
+      }
+      slot = parent_slot;
+    }
+  }
+
+public:
+
+  PhylogenyTracker( const PhylogenyTracker& ) = delete;
+  PhylogenyTracker& operator=( const PhylogenyTracker& ) = delete;
+
+  static PhylogenyTracker& Get() {
+    thread_local PhylogenyTracker tracker;
+    return tracker;
+  }
+
+  bool IsOpen() const { return open; }
+
+  /// Begin tracking, founding a root taxon for each living cell.
+  /// No-op if `PHYLOGENY_TRACKING` is unset.
+  template< typename ThreadWorld >
+  void Open( ThreadWorld& world ) {
+    if ( !dish2::cfg.PHYLOGENY_TRACKING() || open ) return;
+    open = true;
+    update = static_cast<uint32_t>( world.GetUpdate() );
+    for ( auto& cell : world.population ) {
+      if ( cell.genome ) cell.genome->taxon_id = FoundTaxon( 0, none );
+    }
+  }
+
+  /// Advance to update and prune taxa whose delay has elapsed.
+  void Advance( const size_t update_ ) {
+    if ( !open ) return;
+    update = static_cast<uint32_t>( update_ );
+
+    const size_t delay = dish2::cfg.PHYLOGENY_PRUNE_DELAY();
+    while ( prune_queue.size() ) {
+      const auto [slot, id] = prune_queue.front();
+      const auto& taxon = taxa[ slot ];
+      // slot may have been recycled, or taxon revived by a late birth,
+      // in which case it is queued again on its next extinction
+      if (
+        taxon.id == id && slots_by_id.count( id )
+        && taxon.num_living == 0 && taxon.num_children == 0
+      ) {
+        if ( update - taxon.last_activity_update < delay ) break;
+        Prune( slot );
+      }
+      prune_queue.pop_front();
+    }
+  }
+
+  /// @return taxon of offspring born from parent taxon.
+  dish2::TaxonID RecordBirth(
+    const dish2::TaxonID parent_id, const bool mutated
+  ) {
+    if ( !open ) return {};
+
+    const uint32_t parent_slot = FindSlot( parent_id );
+    if ( mutated || parent_slot == none ) {
+      return FoundTaxon( parent_id.GetID(), parent_slot );
+    }
+
+    auto& parent = taxa[ parent_slot ];
+    ++parent.num_living;
+    parent.extinction_update = extant;
+    parent.last_activity_update = update;
+    return parent_id;
+  }
+
+  void RecordDeath( const dish2::TaxonID taxon_id ) {
+    if ( !open ) return;
+
+    const uint32_t slot = FindSlot( taxon_id );
+    if ( slot == none ) return;
+
+    auto& taxon = taxa[ slot ];
+    emp_assert( taxon.num_living );
+    taxon.last_activity_update = update;
+    if ( --taxon.num_living == 0 ) {
+      taxon.extinction_update = update;
+      if ( taxon.num_children == 0 ) {
+        prune_queue.emplace_back( slot, taxon.id );
+      }
+    }
+  }
+
+  /// Offspring may be born after the sender dies, so sends defer pruning.
+  void RecordSpawn( const dish2::TaxonID taxon_id ) {
+    if ( !open ) return;
+
+    const uint32_t slot = FindSlot( taxon_id );
+    if ( slot == none ) return;
+
+    ++taxa[ slot ].num_spawns_sent;
+    taxa[ slot ].last_activity_update = update;
+  }
+
+  size_t GetNumTaxa() const { return slots_by_id.size(); }
+
+  /// Write retained taxa, ordered so that parents precede children.
+  template< typename Archive >
+  void Save( Archive& ar ) const {
+
+    ar( uint64_t{ GetNumTaxa() } );
+
+    // emit roots first, then children of emitted taxa
+    emp::vector< emp::vector< uint32_t > > children( taxa.size() );
+    emp::vector< uint32_t > frontier;
+    for ( const auto& [id, slot] : slots_by_id ) {
+      const uint32_t parent_slot = taxa[ slot ].parent_slot;
+      if ( parent_slot == none ) frontier.push_back( slot );
+      else children[ parent_slot ].push_back( slot );
+    }
+
+    while ( frontier.size() ) {
+      const uint32_t slot = frontier.back();
+      frontier.pop_back();
+      ar( taxa[ slot ] );
+      frontier.insert(
+        std::end( frontier ),
+        std::begin( children[ slot ] ), std::end( children[ slot ] )
+      );
+    }
+
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PHYLOGENY_PHYLOGENYTRACKER_HPP_INCLUDE
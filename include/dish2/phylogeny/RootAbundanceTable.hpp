@@ -0,0 +1,113 @@
+#pragma once
+#ifndef DISH2_PHYLOGENY_ROOTABUNDANCETABLE_HPP_INCLUDE
+#define DISH2_PHYLOGENY_ROOTABUNDANCETABLE_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+namespace dish2 {
+
+/// Number of live cells descended from each phylogenetic root in a thread's
+/// population, kept up to date as cells are born and die.
+/// No-op until opened on a world, after which cells must only be made alive
+/// or killed through `MakeAliveRoutine` and `DeathRoutine`.
+/// Cells outside the opened world's population, such as those of scratch
+/// worlds built during analysis, are ignored.
+class RootAbundanceTable {
+
+  // root ID to number of live cells, roots with no live cells are erased
+  std::unordered_map< size_t, size_t > counts;
+  size_t num_live_cells{};
+
+  // population table was opened on, if any
+  const void* population_begin{ nullptr };
+  const void* population_end{ nullptr };
+
+  template< typename Cell >
+  bool Contains( const Cell& cell ) const {
+    const std::less< const void* > less;
+    return !less( &cell, population_begin ) && less( &cell, population_end );
+  }
+
+  RootAbundanceTable() = default;
+
+public:
+
+  RootAbundanceTable( const RootAbundanceTable& ) = delete;
+  RootAbundanceTable& operator=( const RootAbundanceTable& ) = delete;
+
+  static RootAbundanceTable& Get() {
+    thread_local RootAbundanceTable table;
+    return table;
+  }
+
+  /// Begin tracking world, counting its current live cells.
+  template< typename ThreadWorld >
+  void Open( const ThreadWorld& world_ ) {
+    counts.clear();
+    num_live_cells = 0;
+    population_begin = world_.population.data();
+    population_end = world_.population.data() + world_.population.size();
+    for ( const auto& cell : world_.population ) {
+      if ( cell.IsAlive() ) RecordBirth( cell );
+    }
+  }
+
+  /// Is table tracking world?
+  template< typename ThreadWorld >
+  bool IsOpenFor( const ThreadWorld& world_ ) const {
+    return population_begin == world_.population.data()
+      && population_end != population_begin;
+  }
+
+  /// Call once cell is alive with its new genome.
+  template< typename Cell >
+  void RecordBirth( const Cell& cell ) {
+    if ( !Contains( cell ) ) return;
+    ++counts[ cell.genome->root_id.GetID() ];
+    ++num_live_cells;
+  }
+
+  /// Call before cell's genome is cleared.
+  template< typename Cell >
+  void RecordDeath( const Cell& cell ) {
+    if ( !Contains( cell ) ) return;
+    const auto it = counts.find( cell.genome->root_id.GetID() );
+    emp_assert( it != std::end( counts ) && it->second );
+    if ( --it->second == 0 ) counts.erase( it );
+    --num_live_cells;
+  }
+
+  size_t GetCount( const size_t root_id ) const {
+    const auto it = counts.find( root_id );
+    return it == std::end( counts ) ? 0 : it->second;
+  }
+
+  size_t GetNumRoots() const { return counts.size(); }
+
+  /// @return map of root IDs to live cell counts.
+  const auto& GetCounts() const { return counts; }
+
+  size_t GetNumLiveCells() const { return num_live_cells; }
+
+  /// @return root IDs and live cell counts, ordered by root ID.
+  emp::vector< std::pair< size_t, size_t > > GetSortedCounts() const {
+    emp::vector< std::pair< size_t, size_t > > res(
+      std::begin( counts ), std::end( counts )
+    );
+    std::sort( std::begin( res ), std::end( res ) );
+    return res;
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_PHYLOGENY_ROOTABUNDANCETABLE_HPP_INCLUDE
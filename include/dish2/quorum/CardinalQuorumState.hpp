@@ -10,6 +10,8 @@
 #include "../../../third-party/Empirical/include/emp/base/array.hpp"
 #include "../../../third-party/signalgp-lite/include/sgpl/utility/ThreadLocalRandom.hpp"
 
+#include "../debug/tally_put.hpp"
+
 #include "CellQuorumState.hpp"
 
 namespace dish2 {
@@ -40,7 +42,7 @@ struct CardinalQuorumState {
     // this is okay for null send
     message_bits.UnsetMask( learned_bits );
 
-    if ( output.TryPut( message_bits ) ) ++half_trip_counter;
+    if ( dish2::tally_put( output, message_bits ) ) ++half_trip_counter;
 
   }
 
@@ -0,0 +1,92 @@
+#pragma once
+#ifndef DISH2_RECORD_ASYNCDUMPQUEUE_HPP_INCLUDE
+#define DISH2_RECORD_ASYNCDUMPQUEUE_HPP_INCLUDE
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "../config/cfg.hpp"
+
+namespace dish2 {
+
+/// Runs dump jobs in FIFO order on a background I/O thread, one per
+/// simulation thread.
+/// Simulation threads snapshot what they need to write, then enqueue a job
+/// that serializes, compresses, and writes that snapshot.
+/// If `ASYNC_DUMP` is unset, jobs run inline.
+class AsyncDumpQueue {
+
+  std::mutex mutex;
+  std::condition_variable job_available;
+  std::condition_variable jobs_complete;
+
+  std::deque< std::function<void()> > jobs;
+  size_t num_incomplete{};
+  bool stopping{};
+
+  // declared last so it starts after other members are initialized
+  std::thread worker;
+
+  void Work() {
+    std::unique_lock lock( mutex );
+    while ( true ) {
+      job_available.wait( lock, [this]{ return stopping || jobs.size(); } );
+      if ( jobs.empty() ) return;
+
+      auto job = std::move( jobs.front() );
+      jobs.pop_front();
+
+      lock.unlock();
+      job();
+      lock.lock();
+
+      if ( --num_incomplete == 0 ) jobs_complete.notify_all();
+    }
+  }
+
+  AsyncDumpQueue() : worker( [this]{ Work(); } ) {}
+
+public:
+
+  static AsyncDumpQueue& Get() {
+    thread_local AsyncDumpQueue queue;
+    return queue;
+  }
+
+  ~AsyncDumpQueue() {
+    {
+      const std::lock_guard guard( mutex );
+      stopping = true;
+    }
+    job_available.notify_one();
+    worker.join();
+  }
+
+  AsyncDumpQueue( const AsyncDumpQueue& ) = delete;
+  AsyncDumpQueue& operator=( const AsyncDumpQueue& ) = delete;
+
+  void Enqueue( std::function<void()> job ) {
+    if ( !dish2::cfg.ASYNC_DUMP() ) { job(); return; }
+
+    {
+      const std::lock_guard guard( mutex );
+      jobs.push_back( std::move( job ) );
+      ++num_incomplete;
+    }
+    job_available.notify_one();
+  }
+
+  /// Block until all enqueued jobs have completed.
+  void Wait() {
+    std::unique_lock lock( mutex );
+    jobs_complete.wait( lock, [this]{ return num_incomplete == 0; } );
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RECORD_ASYNCDUMPQUEUE_HPP_INCLUDE
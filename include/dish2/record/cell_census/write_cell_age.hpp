@@ -14,10 +14,10 @@
 
 namespace dish2 {
 
-template< typename Spec >
+template< typename Spec, typename DataFile >
 void write_cell_age(
   const dish2::ThreadWorld<Spec>& world,
-  emp::DataFile& file,
+  DataFile& file,
   std::string& metric,
   double& value,
   size_t& cell_idx
@@ -15,10 +15,10 @@
 
 namespace dish2 {
 
-template< typename Spec >
+template< typename Spec, typename DataFile >
 void write_kin_group_age(
   const dish2::ThreadWorld<Spec>& world,
-  emp::DataFile& file,
+  DataFile& file,
   std::string& metric,
   double& value,
   size_t& cell_idx
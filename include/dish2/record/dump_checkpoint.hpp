@@ -0,0 +1,86 @@
+#pragma once
+#ifndef DISH2_RECORD_DUMP_CHECKPOINT_HPP_INCLUDE
+#define DISH2_RECORD_DUMP_CHECKPOINT_HPP_INCLUDE
+
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "../../../third-party/cereal/include/cereal/archives/binary.hpp"
+#include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+
+#include "../config/cfg.hpp"
+#include "../utility/pare_keyname_filename.hpp"
+#include "../world/serialize_checkpoint.hpp"
+#include "../world/ThreadWorld.hpp"
+
+#include "AsyncDumpQueue.hpp"
+#include "make_compressed_ofstream.hpp"
+
+#include "make_filename/make_artifact_path.hpp"
+#include "make_filename/make_checkpoint_filename.hpp"
+
+namespace dish2 {
+
+/// Each thread writes its own checkpoint file, so threads dump in parallel.
+/// Files are written under a temporary name and renamed once complete, so
+/// a checkpoint that exists under its final name is never partial.
+template< typename Spec >
+void dump_checkpoint(
+  const dish2::ThreadWorld< Spec >& world, const size_t thread_idx
+) {
+
+  const std::string out_filename( dish2::pare_keyname_filename(
+    dish2::make_checkpoint_filename( thread_idx, world.GetUpdate() ),
+    dish2::make_artifact_path()
+  ) );
+
+  // snapshot uncompressed on simulation thread
+  std::ostringstream snapshot;
+  {
+    cereal::BinaryOutputArchive archive( snapshot );
+
+    dish2::serialize_checkpoint( archive, world );
+  }
+
+  // compress and write in background
+  dish2::AsyncDumpQueue::Get().Enqueue( [
+    out_filename, thread_idx,
+    update = world.GetUpdate(),
+    buffer = snapshot.str()
+  ](){
+
+    const std::string out_path = dish2::make_artifact_path( out_filename );
+    // hidden name doesn't match keyname filters used by restore
+    const std::string temp_path = dish2::make_artifact_path(
+      "." + out_filename + ".tmp"
+    );
+
+    {
+      const auto os = dish2::make_compressed_ofstream(
+        temp_path,
+        dish2::cfg.CHECKPOINT_CODEC(),
+        dish2::cfg.CHECKPOINT_CODEC_LEVEL()
+      );
+      os->write( buffer.data(), buffer.size() );
+      os->flush();
+      emp_always_assert( *os, temp_path );
+    } // stream closes, finishing compressed output
+
+    emp_always_assert(
+      std::rename( temp_path.c_str(), out_path.c_str() ) == 0,
+      temp_path, out_path
+    );
+
+    std::cout << "proc " << uitsl::get_proc_id() << " thread " << thread_idx
+      << " dumped checkpoint at update " << update << std::endl;
+
+  } );
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RECORD_DUMP_CHECKPOINT_HPP_INCLUDE
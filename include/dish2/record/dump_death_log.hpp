@@ -3,17 +3,24 @@
 #define DISH2_RECORD_DUMP_DEATH_LOG_HPP_INCLUDE
 
 #include <algorithm>
+#include <fstream>
+#include <memory>
+#include <sstream>
 #include <string>
 
-#include "../../../third-party/bxzstr/include/bxzstr.hpp"
 #include "../../../third-party/conduit/include/uitsl/algorithm/for_each.hpp"
 #include "../../../third-party/Empirical/include/emp/data/DataFile.hpp"
 #include "../../../third-party/signalgp-lite/include/sgpl/utility/CountingIterator.hpp"
 
+#include "../config/cfg.hpp"
 #include "../config/has_replicate.hpp"
 #include "../config/has_series.hpp"
 #include "../config/has_stint.hpp"
 #include "../utility/pare_keyname_filename.hpp"
+#include "../utility/xz_compress_parallel.hpp"
+
+#include "AsyncDumpQueue.hpp"
+#include "get_dump_compression_budget.hpp"
 
 #include "make_filename/make_data_path.hpp"
 #include "make_filename/make_death_log_filename.hpp"
@@ -32,10 +39,14 @@ void dump_death_log(
     dish2::make_data_path()
   );
 
-  thread_local bxz::ofstream out_stream(
-    dish2::make_data_path( out_filename ), bxz::lzma, 9
+  // shared with background writes
+  thread_local auto out_stream = std::make_shared< std::ofstream >(
+    dish2::make_data_path( out_filename ), std::ios::binary
   );
-  emp::DataFile file( out_stream );
+
+  // format on simulation thread, compress and write in background
+  std::ostringstream formatted;
+  emp::DataFile file( formatted );
 
   if ( dish2::has_stint() ) file.AddVal(cfg.STINT(), "Stint");
   if ( dish2::has_series() ) file.AddVal(cfg.SERIES(), "Series");
@@ -71,8 +82,17 @@ void dump_death_log(
     }
   );
 
-  std::cout << "proc " << uitsl::get_proc_id() << " thread " << thread_idx
-    << " dumped death log" << std::endl;
+  dish2::AsyncDumpQueue::Get().Enqueue( [
+    stream = out_stream, buffer = formatted.str(), thread_idx
+  ](){
+    // appended xz streams concatenate into a valid xz file
+    const std::string compressed = dish2::xz_compress_parallel(
+      buffer, 9, dish2::get_dump_compression_budget()
+    );
+    stream->write( compressed.data(), compressed.size() );
+    std::cout << "proc " << uitsl::get_proc_id() << " thread " << thread_idx
+      << " dumped death log" << std::endl;
+  } );
 
 }
 
@@ -144,14 +144,8 @@ void dump_genome_statistics(
   file.AddVar(num_local_regulation_insts, "Num Local Regulation Instructions");
 
   // other program attributes
-  const double program_compression_ratio = dish2::measure_compression_ratio(
-    [&](){
-      std::ostringstream ss;
-      cereal::BinaryOutputArchive archive( ss );
-      archive( genome.program );
-      return ss.str();
-    }()
-  );
+  const double program_compression_ratio
+    = dish2::measure_serialized_compression_ratio( genome.program );
   file.AddVar(program_compression_ratio, "Program Compression Ratio");
 
   const size_t num_instructions = genome.program.size();
@@ -0,0 +1,70 @@
+#pragma once
+#ifndef DISH2_RECORD_DUMP_PHYLOGENY_HPP_INCLUDE
+#define DISH2_RECORD_DUMP_PHYLOGENY_HPP_INCLUDE
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "../../../third-party/cereal/include/cereal/archives/binary.hpp"
+#include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+
+#include "../config/cfg.hpp"
+#include "../phylogeny/PhylogenyTracker.hpp"
+#include "../utility/pare_keyname_filename.hpp"
+#include "../utility/xz_compress_parallel.hpp"
+
+#include "make_filename/make_data_path.hpp"
+#include "make_filename/make_phylogeny_filename.hpp"
+#include "AsyncDumpQueue.hpp"
+#include "get_dump_compression_budget.hpp"
+
+namespace dish2 {
+
+/// File layout, after xz decompression: magic and version, then the number of
+/// taxa, then each taxon as id, parent id (zero if root), origin update,
+/// extinction update (UINT32_MAX if extant), number living, and number of
+/// spawns sent.
+/// Parents precede their children, except for parents on other threads.
+void dump_phylogeny(
+  const dish2::PhylogenyTracker& tracker, const size_t thread_idx
+) {
+
+  if ( !tracker.IsOpen() ) return;
+
+  const std::string out_filename = dish2::pare_keyname_filename(
+    dish2::make_phylogeny_filename( thread_idx ),
+    dish2::make_data_path()
+  );
+
+  // serialize on calling thread, compress and write in background
+  std::ostringstream buffer;
+  {
+    cereal::BinaryOutputArchive archive( buffer );
+    buffer.write( "DISH2PT", 8 );
+    archive( uint32_t{ 1 } );
+    tracker.Save( archive );
+  }
+
+  dish2::AsyncDumpQueue::Get().Enqueue( [
+    out_filename, buffer = buffer.str(), thread_idx
+  ](){
+    const std::string compressed = dish2::xz_compress_parallel(
+      buffer, 9, dish2::get_dump_compression_budget()
+    );
+    std::ofstream out_stream(
+      dish2::make_data_path( out_filename ), std::ios::binary
+    );
+    emp_always_assert( out_stream, out_filename );
+    out_stream.write( compressed.data(), compressed.size() );
+    std::cout << "proc " << uitsl::get_proc_id() << " thread " << thread_idx
+      << " dumped phylogeny" << std::endl;
+  } );
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RECORD_DUMP_PHYLOGENY_HPP_INCLUDE
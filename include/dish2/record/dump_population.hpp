@@ -5,48 +5,80 @@
 #include <fstream>
 #include <string>
 
-#include "../../../third-party/bxzstr/include/bxzstr.hpp"
 #include "../../../third-party/cereal/include/cereal/archives/binary.hpp"
 #include "../../../third-party/cereal/include/cereal/types/vector.hpp"
+#include "../../../third-party/Empirical/include/emp/base/optional.hpp"
 #include "../../../third-party/Empirical/include/emp/base/vector.hpp"
 
+#include "../archive/write_population_archive.hpp"
+#include "../config/cfg.hpp"
 #include "../genome/Genome.hpp"
 #include "../utility/pare_keyname_filename.hpp"
 #include "../world/iterators/GenotypeConstWrapper.hpp"
 #include "../world/iterators/LiveCellIterator.hpp"
 #include "../world/ThreadWorld.hpp"
 
+#include "AsyncDumpQueue.hpp"
+#include "make_compressed_ofstream.hpp"
+
 #include "make_filename/make_artifact_path.hpp"
 #include "make_filename/make_dump_population_filename.hpp"
 
 namespace dish2 {
 
+/// @param snapshot whether this is a mid-run snapshot rather than the final
+/// dump.
 template< typename Spec >
 void dump_population(
-  const dish2::ThreadWorld< Spec >& world, const size_t thread_idx
+  const dish2::ThreadWorld< Spec >& world,
+  const size_t thread_idx,
+  const bool snapshot=false
 ) {
 
   const auto& population = world.population;
 
   const std::string out_filename( dish2::pare_keyname_filename(
-    dish2::make_dump_population_filename( thread_idx ),
+    dish2::make_dump_population_filename(
+      thread_idx,
+      snapshot ? emp::optional< size_t >{ world.GetUpdate() } : std::nullopt
+    ),
     dish2::make_artifact_path()
   ) );
 
-  bxz::ofstream os( dish2::make_artifact_path( out_filename ), bxz::lzma, 9);
-  cereal::BinaryOutputArchive archive( os );
-
-  archive( emp::vector< dish2::Genome<Spec> >(
-    dish2::GenotypeConstWrapper<Spec>(
-      dish2::LiveCellIterator<Spec>::make_begin( population )
-    ),
-    dish2::GenotypeConstWrapper<Spec>(
-      dish2::LiveCellIterator<Spec>::make_end( population )
+  // snapshot on simulation thread, serialize and compress in background
+  dish2::AsyncDumpQueue::Get().Enqueue( [
+    out_filename, thread_idx,
+    genomes = emp::vector< dish2::Genome<Spec> >(
+      dish2::GenotypeConstWrapper<Spec>(
+        dish2::LiveCellIterator<Spec>::make_begin( population )
+      ),
+      dish2::GenotypeConstWrapper<Spec>(
+        dish2::LiveCellIterator<Spec>::make_end( population )
+      )
     )
-  ) );
+  ](){
+
+    if ( dish2::cfg.POPULATION_ARCHIVE() ) {
+      dish2::write_population_archive<Spec>(
+        dish2::make_artifact_path( out_filename ),
+        genomes,
+        dish2::cfg.POPULATION_ARCHIVE_LEVEL()
+      );
+    } else {
+      const auto os = dish2::make_compressed_ofstream(
+        dish2::make_artifact_path( out_filename ),
+        dish2::cfg.POPULATION_CODEC(),
+        dish2::cfg.POPULATION_CODEC_LEVEL()
+      );
+      cereal::BinaryOutputArchive archive( *os );
+
+      archive( genomes );
+    }
+
+    std::cout << "proc " << uitsl::get_proc_id() << " thread " << thread_idx
+      << " dumped population" << std::endl;
 
-  std::cout << "proc " << uitsl::get_proc_id() << " thread " << thread_idx
-    << " dumped population" << std::endl;
+  } );
 
 }
 
@@ -0,0 +1,20 @@
+#pragma once
+#ifndef DISH2_RECORD_GET_DUMP_COMPRESSION_BUDGET_HPP_INCLUDE
+#define DISH2_RECORD_GET_DUMP_COMPRESSION_BUDGET_HPP_INCLUDE
+
+#include "../config/cfg.hpp"
+#include "../parallel/ThreadBudget.hpp"
+
+namespace dish2 {
+
+/// @return compression budget shared by all dumps of all simulation threads
+/// of this process, so concurrent dumps don't oversubscribe cores or
+/// memory.
+dish2::ThreadBudget& get_dump_compression_budget() {
+  static dish2::ThreadBudget budget( dish2::cfg.DUMP_COMPRESSION_THREADS() );
+  return budget;
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RECORD_GET_DUMP_COMPRESSION_BUDGET_HPP_INCLUDE
@@ -0,0 +1,36 @@
+#pragma once
+#ifndef DISH2_RECORD_MAKE_COMPRESSED_OFSTREAM_HPP_INCLUDE
+#define DISH2_RECORD_MAKE_COMPRESSED_OFSTREAM_HPP_INCLUDE
+
+#include <fstream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include "../../../third-party/bxzstr/include/bxzstr.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+
+namespace dish2 {
+
+/// Open path for writing through codec.
+/// @param codec one of "none", "gz", or "xz".
+/// @param level compression level, ignored for "none".
+std::unique_ptr< std::ostream > make_compressed_ofstream(
+  const std::string& path, const std::string& codec, const int level
+) {
+  if ( codec == "none" ) return std::make_unique< std::ofstream >(
+    path, std::ios::binary
+  );
+  else if ( codec == "gz" ) return std::make_unique< bxz::ofstream >(
+    path, bxz::z, level
+  );
+  else if ( codec == "xz" ) return std::make_unique< bxz::ofstream >(
+    path, bxz::lzma, level
+  );
+  else emp_always_assert( false, "unknown codec", codec );
+  __builtin_unreachable();
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RECORD_MAKE_COMPRESSED_OFSTREAM_HPP_INCLUDE
@@ -0,0 +1,22 @@
+#pragma once
+#ifndef DISH2_RECORD_MAKE_FILENAME_MAKE_CODEC_EXTENSION_HPP_INCLUDE
+#define DISH2_RECORD_MAKE_FILENAME_MAKE_CODEC_EXTENSION_HPP_INCLUDE
+
+#include <string>
+
+#include "../../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+
+namespace dish2 {
+
+/// @param codec one of "none", "gz", or "xz".
+std::string make_codec_extension( const std::string& codec ) {
+  if ( codec == "none" ) return "";
+  else if ( codec == "gz" ) return ".gz";
+  else if ( codec == "xz" ) return ".xz";
+  else emp_always_assert( false, "unknown codec", codec );
+  __builtin_unreachable();
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RECORD_MAKE_FILENAME_MAKE_CODEC_EXTENSION_HPP_INCLUDE
@@ -7,6 +7,7 @@
 
 #include "../../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
 #include "../../../../third-party/Empirical/include/emp/base/macros.hpp"
+#include "../../../../third-party/Empirical/include/emp/base/optional.hpp"
 #include "../../../../third-party/Empirical/include/emp/tools/keyname_utils.hpp"
 #include "../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
 
@@ -17,17 +18,27 @@
 #include "../../config/has_series.hpp"
 #include "../../config/has_stint.hpp"
 
+#include "make_population_extension.hpp"
+
 namespace dish2 {
 
-std::string make_dump_population_filename( const size_t thread_idx) {
+/// @param snapshot_update if set, name as a mid-run snapshot at this update.
+std::string make_dump_population_filename(
+  const size_t thread_idx,
+  const emp::optional< size_t > snapshot_update=std::nullopt
+) {
   auto keyname_attributes = emp::keyname::unpack_t{
-    {"a", "population"},
+    {"a", snapshot_update ? "population_snapshot" : "population"},
     {"source", EMP_STRINGIFY(DISHTINY_HASH_)},
     {"proc", emp::to_string( uitsl::get_proc_id() )},
     {"thread", emp::to_string(thread_idx)},
-    {"ext", ".bin.xz"}
+    {"ext", dish2::make_population_extension()}
   };
 
+  if ( snapshot_update ) {
+    keyname_attributes[ "update" ] = emp::to_string( *snapshot_update );
+  }
+
   if ( dish2::get_repro() ) {
     keyname_attributes[ "repro" ] = *dish2::get_repro();
   }
@@ -0,0 +1,25 @@
+#pragma once
+#ifndef DISH2_RECORD_MAKE_FILENAME_MAKE_POPULATION_EXTENSION_HPP_INCLUDE
+#define DISH2_RECORD_MAKE_FILENAME_MAKE_POPULATION_EXTENSION_HPP_INCLUDE
+
+#include <string>
+
+#include "../../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+#include "../../config/cfg.hpp"
+
+#include "make_codec_extension.hpp"
+
+namespace dish2 {
+
+/// File extension for population dumps under the current configuration.
+std::string make_population_extension() {
+  if ( cfg.POPULATION_ARCHIVE() ) return ".dpa";
+  else return emp::to_string(
+    ".bin", dish2::make_codec_extension( cfg.POPULATION_CODEC() )
+  );
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RECORD_MAKE_FILENAME_MAKE_POPULATION_EXTENSION_HPP_INCLUDE
@@ -9,9 +9,11 @@
 #include "../../../third-party/Empirical/include/emp/base/macros.hpp"
 #include "../../../third-party/Empirical/include/emp/data/DataFile.hpp"
 
+#include "../config/cfg.hpp"
 #include "../config/has_replicate.hpp"
 #include "../config/has_series.hpp"
 #include "../config/has_stint.hpp"
+#include "../utility/ColumnarDataFile.hpp"
 #include "../utility/pare_keyname_filename.hpp"
 
 #include "cell_census/write_cell_age.hpp"
@@ -25,21 +27,16 @@
 
 namespace dish2 {
 
-template< typename Spec >
+namespace internal {
+
+template< typename Spec, typename DataFile >
 void write_cell_census(
-  const dish2::ThreadWorld< Spec >& world, const size_t thread_idx
+  const dish2::ThreadWorld< Spec >& world,
+  const size_t thread_idx,
+  DataFile& file
 ) {
 
-  const thread_local std::string out_filename = dish2::pare_keyname_filename(
-    dish2::make_cell_census_filename( thread_idx ),
-    dish2::make_data_path()
-  );
-
-  thread_local bxz::ofstream out_stream(
-    dish2::make_data_path( out_filename ), bxz::lzma, 9
-  );
-  thread_local emp::DataFile file( out_stream );
-
+  // thread_local statics are separate for each DataFile type
   thread_local std::string metric;
   thread_local double value;
   thread_local size_t cell_idx;
@@ -48,7 +45,7 @@ void write_cell_census(
   update = world.GetUpdate();
 
   thread_local std::once_flag once_flag;
-  std::call_once(once_flag, [thread_idx](){
+  std::call_once(once_flag, [thread_idx, &file](){
     if ( dish2::has_stint() ) file.AddVal(cfg.STINT(), "Stint");
     if ( dish2::has_series() ) file.AddVal(cfg.SERIES(), "Series");
     if ( dish2::has_replicate() ) file.AddVal(cfg.REPLICATE(), "Replicate");
@@ -73,6 +70,35 @@ void write_cell_census(
 
 }
 
+} // namespace internal
+
+template< typename Spec >
+void write_cell_census(
+  const dish2::ThreadWorld< Spec >& world, const size_t thread_idx
+) {
+
+  const thread_local std::string out_filename = dish2::pare_keyname_filename(
+    dish2::make_cell_census_filename( thread_idx ),
+    dish2::make_data_path()
+  );
+
+  if ( cfg.DATA_COLUMNAR() ) {
+    thread_local dish2::ColumnarDataFile file(
+      dish2::make_data_path( out_filename ),
+      cfg.DATA_COLUMNAR_ROW_GROUP_SIZE(),
+      cfg.DATA_COLUMNAR_LEVEL()
+    );
+    dish2::internal::write_cell_census<Spec>( world, thread_idx, file );
+  } else {
+    thread_local bxz::ofstream out_stream(
+      dish2::make_data_path( out_filename ), bxz::lzma, 9
+    );
+    thread_local emp::DataFile file( out_stream );
+    dish2::internal::write_cell_census<Spec>( world, thread_idx, file );
+  }
+
+}
+
 } // namespace dish2
 
 #endif // #ifndef DISH2_RECORD_WRITE_CELL_CENSUS_HPP_INCLUDE
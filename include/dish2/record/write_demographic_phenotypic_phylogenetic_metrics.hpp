@@ -2,606 +2,871 @@
 #ifndef DISH2_RECORD_WRITE_DEMOGRAPHIC_PHENOTYPIC_PHYLOGENETIC_METRICS_HPP_INCLUDE
 #define DISH2_RECORD_WRITE_DEMOGRAPHIC_PHENOTYPIC_PHYLOGENETIC_METRICS_HPP_INCLUDE
 
+#include <algorithm>
+#include <functional>
 #include <mutex>
+#include <numeric>
+#include <string>
 
+#include <mpi.h>
+
+#include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
 #include "../../../third-party/Empirical/include/emp/base/macros.hpp"
+#include "../../../third-party/Empirical/include/emp/base/optional.hpp"
 #include "../../../third-party/Empirical/include/emp/data/DataFile.hpp"
-
+#include "../../../third-party/magic_enum/include/magic_enum.hpp"
+#include "../../../third-party/signalgp-lite/include/sgpl/introspection/count_modules.hpp"
+
+#include "../cell/cardinal_iterators/ApoptosisRequestWrapper.hpp"
+#include "../cell/cardinal_iterators/CellAgeWrapper.hpp"
+#include "../cell/cardinal_iterators/EntireElapsedInstructionCyclesWrapper.hpp"
+#include "../cell/cardinal_iterators/EpochWrapper.hpp"
+#include "../cell/cardinal_iterators/IncomingInterMessageCounterWrapper.hpp"
+#include "../cell/cardinal_iterators/IncomingIntraMessageCounterWrapper.hpp"
+#include "../cell/cardinal_iterators/KinGroupAgeWrapper.hpp"
+#include "../cell/cardinal_iterators/ResourceInputPeekWrapper.hpp"
+#include "../cell/cardinal_iterators/ResourceReceiveResistanceWrapper.hpp"
+#include "../cell/cardinal_iterators/ResourceReserveRequestWrapper.hpp"
+#include "../cell/cardinal_iterators/ResourceSendRequestWrapper.hpp"
+#include "../cell/cardinal_iterators/ResourceStockpileWrapper.hpp"
+#include "../cell/cardinal_iterators/SpawnArrestWrapper.hpp"
+#include "../cell/cardinal_iterators/SpawnCountWrapper.hpp"
+#include "../cell/cardinal_iterators/SpawnRequestWrapper.hpp"
 #include "../config/cfg.hpp"
 #include "../config/has_replicate.hpp"
 #include "../config/has_series.hpp"
 #include "../config/has_stint.hpp"
-#include "../introspection/any_live_cells.hpp"
+#include "../debug/MeshPutTally.hpp"
+#include "../enum/CauseOfDeath.hpp"
 #include "../introspection/count_birth_events.hpp"
-#include "../introspection/count_cardinals.hpp"
-#include "../introspection/count_dead_cells.hpp"
 #include "../introspection/count_death_events.hpp"
-#include "../introspection/count_kin_neighbors.hpp"
-#include "../introspection/count_live_cardinals.hpp"
-#include "../introspection/count_live_cells.hpp"
 #include "../introspection/count_spawn_events.hpp"
-#include "../introspection/count_unique_coding_genotypes.hpp"
-#include "../introspection/count_unique_module_expression_profiles.hpp"
-#include "../introspection/count_unique_module_regulation_profiles.hpp"
+#include "../introspection/count_unique_coding_genotypes_parallel.hpp"
+#include "../introspection/count_unique_module_expression_profiles_parallel.hpp"
+#include "../introspection/count_unique_module_regulation_profiles_parallel.hpp"
 #include "../introspection/count_unique_root_ids.hpp"
 #include "../introspection/count_unique_stint_root_ids.hpp"
-#include "../introspection/get_fraction_cardinals_apoptosis_request.hpp"
-#include "../introspection/get_fraction_cardinals_incoming_inter_message.hpp"
-#include "../introspection/get_fraction_cardinals_incoming_intra_message.hpp"
-#include "../introspection/get_fraction_cardinals_receiving_resource.hpp"
-#include "../introspection/get_fraction_cardinals_resource_receive_resistance.hpp"
-#include "../introspection/get_fraction_cardinals_resource_reserve_request.hpp"
-#include "../introspection/get_fraction_cardinals_resource_send_request.hpp"
-#include "../introspection/get_fraction_cardinals_spawn_arrest.hpp"
-#include "../introspection/get_fraction_cardinals_spawn_request.hpp"
-#include "../introspection/get_fraction_cells_apoptosis_request.hpp"
-#include "../introspection/get_fraction_cells_incoming_inter_message.hpp"
-#include "../introspection/get_fraction_cells_incoming_intra_message.hpp"
-#include "../introspection/get_fraction_cells_kin_group_loners.hpp"
-#include "../introspection/get_fraction_cells_receiving_resource.hpp"
-#include "../introspection/get_fraction_cells_resource_receive_resistance.hpp"
-#include "../introspection/get_fraction_cells_resource_reserve_request.hpp"
-#include "../introspection/get_fraction_cells_resource_send_request.hpp"
-#include "../introspection/get_fraction_cells_spawn_arrest.hpp"
-#include "../introspection/get_fraction_cells_spawn_request.hpp"
-#include "../introspection/get_fraction_fecund_resource_stockpile.hpp"
-#include "../introspection/get_fraction_nulliparous.hpp"
-#include "../introspection/get_maximum_kin_group_size.hpp"
-#include "../introspection/get_mean_cell_age.hpp"
-#include "../introspection/get_mean_elapsed_insertions_deletions.hpp"
-#include "../introspection/get_mean_elapsed_mutation_occurences.hpp"
-#include "../introspection/get_mean_elapsed_point_mutations.hpp"
-#include "../introspection/get_mean_epoch.hpp"
-#include "../introspection/get_mean_generation.hpp"
-#include "../introspection/get_mean_genome_compression_ratio.hpp"
-#include "../introspection/get_mean_incoming_inter_message_count_per_cardinal.hpp"
-#include "../introspection/get_mean_incoming_inter_message_count_per_cell.hpp"
-#include "../introspection/get_mean_incoming_intra_message_count_per_cardinal.hpp"
-#include "../introspection/get_mean_incoming_intra_message_count_per_cell.hpp"
-#include "../introspection/get_mean_kin_group_age.hpp"
-#include "../introspection/get_mean_kin_group_size.hpp"
-#include "../introspection/get_mean_module_count.hpp"
-#include "../introspection/get_mean_program_length.hpp"
-#include "../introspection/get_mean_resource_received_per_cardinal.hpp"
-#include "../introspection/get_mean_resource_received_per_cell.hpp"
-#include "../introspection/get_mean_resource_stockpile.hpp"
-#include "../introspection/get_mean_spawn_count.hpp"
-#include "../introspection/get_median_kin_group_size.hpp"
-#include "../introspection/get_num_running_log_cardinal_updates.hpp"
-#include "../introspection/get_num_running_log_cell_updates.hpp"
-#include "../introspection/get_num_running_log_live_cardinal_updates.hpp"
-#include "../introspection/get_num_running_log_live_cell_updates.hpp"
+#include "../introspection/DistinctCountSketches.hpp"
+#include "../introspection/FusedPopulationScan.hpp"
+#include "../introspection/get_mean_genome_compression_ratio_parallel.hpp"
+#include "../introspection/get_num_running_log_updates.hpp"
 #include "../introspection/get_population_compression_ratio.hpp"
 #include "../introspection/get_prevalent_coding_genotype.hpp"
-#include "../introspection/make_causes_of_death_string_histogram.hpp"
-#include "../introspection/sum_entire_elapsed_instruction_cycles_for_live_cells.hpp"
-#include "../introspection/sum_entire_elapsed_instruction_cycles.hpp"
+#include "../introspection/KinGroupSizeStats.hpp"
+#include "../parallel/GlobalAllreduce.hpp"
+#include "../runninglog/DeathEvent.hpp"
+#include "../utility/ColumnarDataFile.hpp"
 #include "../utility/pare_keyname_filename.hpp"
 
 #include "make_filename/make_data_path.hpp"
 #include "make_filename/make_demographic_phenotypic_phylogenetic_metrics_filename.hpp"
+#include "make_filename/make_global_demographic_phenotypic_phylogenetic_metrics_filename.hpp"
 
 namespace dish2 {
 
-template< typename Spec >
-void write_demographic_phenotypic_phylogenetic_metrics(
-  const dish2::ThreadWorld< Spec >& world, const size_t thread_idx
-) {
+namespace internal {
 
-  const thread_local std::string out_filename = dish2::pare_keyname_filename(
-    dish2::make_demographic_phenotypic_phylogenetic_metrics_filename(
-      thread_idx
-    ),
-    dish2::make_data_path()
+// value of cell's first cardinal, as by dish2::WorldIteratorAbridger
+template< typename CardinalIterator, typename Cell >
+decltype(auto) first_cardinal( const Cell& cell ) {
+  return *cell.template begin< CardinalIterator >();
+}
+
+// sum over cell's cardinals, as by dish2::WorldIteratorAdapter
+template< typename CardinalIterator, typename Cell >
+double sum_cardinals( const Cell& cell ) {
+  return std::accumulate(
+    cell.template begin< CardinalIterator >(),
+    cell.template end< CardinalIterator >(),
+    0.0
   );
+}
 
-  thread_local emp::DataFile file( dish2::make_data_path(
-    out_filename
-  ) );
+template< typename CardinalIterator, typename Cell >
+double count_cardinals_if( const Cell& cell ) {
+  return std::count_if(
+    cell.template begin< CardinalIterator >(),
+    cell.template end< CardinalIterator >(),
+    []( const auto& val ){ return static_cast<bool>( val ); }
+  );
+}
 
-  thread_local std::string metric;
-  thread_local double value;
-  thread_local size_t update;
+// as by dish2::WorldIteratorAnyOfer
+template< typename CardinalIterator, typename Cell >
+double any_cardinal( const Cell& cell ) {
+  return std::any_of(
+    cell.template begin< CardinalIterator >(),
+    cell.template end< CardinalIterator >(),
+    []( const auto& val ){ return static_cast<bool>( val ); }
+  );
+}
 
-  update = world.GetUpdate();
+/// Per-thread analyses backing metrics, kept between writes.
+template< typename Spec >
+struct DemographicPhenotypicPhylogeneticMetricsState {
+  dish2::FusedPopulationScan< Spec > scan;
+  dish2::KinGroupSizeStats< Spec > kin_group_size_stats;
+  // only with DISTINCT_COUNT_SKETCH_PRECISION
+  emp::optional< dish2::DistinctCountSketches< Spec > > sketches;
+};
+
+/// Register metrics in output order.
+/// Per-cell metrics are fused into a single pass over the population.
+/// Kin group size and distinct count metrics read from state, which must be
+/// run before the scan and outlive it.
+template< typename Spec >
+void register_demographic_phenotypic_phylogenetic_metrics(
+  dish2::internal::DemographicPhenotypicPhylogeneticMetricsState< Spec >& state
+) {
 
-  thread_local std::once_flag once_flag;
-  std::call_once(once_flag, [thread_idx](){
-    if ( dish2::has_stint() ) file.AddVal(cfg.STINT(), "Stint");
-    if ( dish2::has_series() ) file.AddVal(cfg.SERIES(), "Series");
-    if ( dish2::has_replicate() ) file.AddVal(cfg.REPLICATE(), "Replicate");
+  auto& scan = state.scan;
+  const auto& kin_group_size_stats = state.kin_group_size_stats;
+  const auto& sketches = state.sketches;
 
-    file.AddVar(metric, "Metric");
-    file.AddVar(value, "Value");
-    file.AddVar(update, "Update");
-    file.PrintHeaderKeys();
+  using scan_t = dish2::FusedPopulationScan< Spec >;
+  using cell_t = dish2::Cell< Spec >;
+  using world_t = dish2::ThreadWorld< Spec >;
+  constexpr auto all_cells = scan_t::Scope::all_cells;
+  constexpr auto live_cells = scan_t::Scope::live_cells;
 
-    std::cout << "proc " << uitsl::get_proc_id() << " thread " << thread_idx
-      << " wrote demographic phenotypic phylogenetic metrics" << std::endl;
-  });
+  const auto num_cell_updates = []( const world_t& world ){
+    return static_cast<double>(
+      dish2::get_num_running_log_updates<Spec>( world ) * world.GetSize()
+    );
+  };
+  const auto num_live_cell_updates = [](
+    const world_t& world, const scan_t& scan
+  ){
+    return static_cast<double>(
+      dish2::get_num_running_log_updates<Spec>( world )
+      * scan.GetNumLiveCells()
+    );
+  };
 
-  {
-    metric = "Number Cells";
-    value = world.GetSize();
-    file.Update();
-  }
+  scan.AddFromCounts( "Number Cells",
+    []( const scan_t& scan ){ return scan.GetNumCells(); }
+  );
 
-  {
-    metric = "Number Cardinals";
-    value = dish2::count_cardinals<Spec>( world );
-    file.Update();
-  }
+  scan.AddFromCounts( "Number Cardinals",
+    []( const scan_t& scan ){ return scan.GetNumCardinals(); }
+  );
 
-  {
-    metric = "Mean Current Epoch";
-    value = dish2::get_mean_epoch<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Mean Current Epoch", all_cells,
+    []( const cell_t& cell ){
+      return first_cardinal< dish2::EpochWrapper<Spec> >( cell ).Get();
+    }
+  );
 
-  {
-    metric = "Random Number Generator Seed";
-    value = sgpl::tlrand.Get().GetSeed();
-    file.Update();
-  }
+  scan.AddComputed( "Random Number Generator Seed",
+    []( const world_t&, const scan_t& ){
+      return sgpl::tlrand.Get().GetSeed();
+    }
+  );
 
   // PHYLOGENETIC METRICS
 
-  {
-    metric = "Number Phylogenetic Roots";
-    value = dish2::count_unique_root_ids<Spec>( world );
-    file.Update();
-  }
+  scan.AddComputed( "Number Phylogenetic Roots",
+    [&sketches]( const world_t& world, const scan_t& ){
+      return sketches
+        ? sketches->EstimateNumRootIDs()
+        : dish2::count_unique_root_ids<Spec>( world );
+    }
+  );
 
-  {
-    metric = "Number Stint Phylogenetic Roots";
-    value = dish2::count_unique_stint_root_ids<Spec>( world );
-    file.Update();
-  }
+  scan.AddComputed( "Number Stint Phylogenetic Roots",
+    [&sketches]( const world_t& world, const scan_t& ){
+      return sketches
+        ? sketches->EstimateNumStintRootIDs()
+        : dish2::count_unique_stint_root_ids<Spec>( world );
+    }
+  );
 
-  {
-    metric = "Mean Elapsed Indel Mutations";
-    value = dish2::get_mean_elapsed_insertions_deletions<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Mean Elapsed Indel Mutations", live_cells,
+    []( const cell_t& cell ){
+      return cell.genome->mutation_counter.insertion_deletion_counter;
+    }
+  );
 
-  {
-    metric = "Mean Elapsed Point Mutations";
-    value = dish2::get_mean_elapsed_point_mutations<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Mean Elapsed Point Mutations", live_cells,
+    []( const cell_t& cell ){
+      return cell.genome->mutation_counter.point_mutation_counter;
+    }
+  );
 
-  {
-    metric = "Mean Elapsed Mutation Occurences";
-    value = dish2::get_mean_elapsed_mutation_occurences<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Mean Elapsed Mutation Occurences", live_cells,
+    []( const cell_t& cell ){
+      return cell.genome->mutation_counter.mutation_occurrence_counter;
+    }
+  );
 
   for (size_t lev{}; lev <= Spec::NLEV; ++lev) {
-    metric = emp::to_string("Mean Elapsed Generations Level ", lev);
-    value = dish2::get_mean_generation<Spec>( world, lev );
-    file.Update();
+    scan.AddMeanPerCell(
+      emp::to_string("Mean Elapsed Generations Level ", lev), live_cells,
+      [lev]( const cell_t& cell ){
+        return cell.genome->generation_counter.elapsed_generations[ lev ];
+      }
+    );
   }
 
   // DEMOGRAPHIC METRICS
 
-  {
-    metric = "Number Dead Cells";
-    value = dish2::count_dead_cells<Spec>( world );
-    file.Update();
-  }
+  scan.AddFromCounts( "Number Dead Cells",
+    []( const scan_t& scan ){
+      return scan.GetNumCells() - scan.GetNumLiveCells();
+    }
+  );
 
-  {
-    metric = "Number Live Cells";
-    value = dish2::count_live_cells<Spec>( world );
-    file.Update();
-  }
+  scan.AddFromCounts( "Number Live Cells",
+    []( const scan_t& scan ){ return scan.GetNumLiveCells(); }
+  );
 
-  {
-    metric = "Extinct";
-    value = !dish2::any_live_cells<Spec>( world );
-    file.Update();
-  }
+  scan.AddFromCounts( "Extinct",
+    []( const scan_t& scan ){ return scan.GetNumLiveCells() == 0; }
+  );
 
-  {
-    metric = "Number Live Cardinals";
-    value = dish2::count_live_cardinals<Spec>( world );
-    file.Update();
-  }
+  scan.AddFromCounts( "Number Live Cardinals",
+    []( const scan_t& scan ){ return scan.GetNumLiveCardinals(); }
+  );
 
-  {
-    metric = "Number Unique Genotypes";
-    value = dish2::count_unique_coding_genotypes<Spec>( world );
-    file.Update();
-  }
+  scan.AddComputed( "Number Unique Genotypes",
+    [&sketches]( const world_t& world, const scan_t& ){
+      return sketches
+        ? sketches->EstimateNumCodingGenotypes()
+        : dish2::count_unique_coding_genotypes_parallel<Spec>(
+          world, dish2::cfg.INTROSPECTION_THREADS()
+        );
+    }
+  );
 
-  {
-    metric = "Population Compression Ratio";
-    value = dish2::get_population_compression_ratio<Spec>( world );
-    file.Update();
-  }
+  scan.AddComputed( "Population Compression Ratio",
+    []( const world_t& world, const scan_t& ){
+      return dish2::get_population_compression_ratio<Spec>( world );
+    }
+  );
 
-  {
-    metric = "Mean Genome Compression Ratio";
-    value = dish2::get_mean_genome_compression_ratio<Spec>( world );
-    file.Update();
-  }
+  scan.AddComputed( "Mean Genome Compression Ratio",
+    []( const world_t& world, const scan_t& ){
+      return dish2::get_mean_genome_compression_ratio_parallel<Spec>(
+        world, dish2::cfg.INTROSPECTION_THREADS()
+      );
+    }
+  );
 
-  {
-    metric = "Mean Program Module Count";
-    value = dish2::get_mean_module_count<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Mean Program Module Count", live_cells,
+    []( const cell_t& cell ){
+      return sgpl::count_modules( cell.genome->program );
+    }
+  );
 
-  {
-    metric = "Mean Program Instruction Count";
-    value = dish2::get_mean_program_length<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Mean Program Instruction Count", live_cells,
+    []( const cell_t& cell ){ return cell.genome->program.size(); }
+  );
 
-  {
-    metric = "Prevalent Genotype Quantity";
-    value = dish2::get_prevalent_coding_genotype<Spec>( world ).second;
-    file.Update();
-  }
+  scan.AddComputed( "Prevalent Genotype Quantity",
+    []( const world_t& world, const scan_t& ){
+      return dish2::get_prevalent_coding_genotype<Spec>( world ).second;
+    }
+  );
 
-  {
-    metric = "Mean Cell Age";
-    value = dish2::get_mean_cell_age<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Mean Cell Age", live_cells,
+    []( const cell_t& cell ){
+      return first_cardinal< dish2::CellAgeWrapper<Spec> >( cell ).Get();
+    }
+  );
 
   for (size_t lev{}; lev < Spec::NLEV; ++lev) {
-    metric = emp::to_string("Mean Kin Group Age Level ", lev);
-    value = dish2::get_mean_kin_group_age<Spec>( world, lev );
-    file.Update();
+    scan.AddMeanPerCell(
+      emp::to_string("Mean Kin Group Age Level ", lev), live_cells,
+      [lev]( const cell_t& cell ){
+        return first_cardinal< dish2::KinGroupAgeWrapper<Spec> >(
+          cell
+        ).Get( lev );
+      }
+    );
   }
 
 
   // PHENOTYPIC METRICS
 
-  {
-    metric = "Number Unique Module Regulation Profiles";
-    value = dish2::count_unique_module_regulation_profiles<Spec>( world );
-    file.Update();
-  }
+  scan.AddComputed( "Number Unique Module Regulation Profiles",
+    [&sketches]( const world_t& world, const scan_t& ){
+      return sketches
+        ? sketches->EstimateNumModuleRegulationProfiles()
+        : dish2::count_unique_module_regulation_profiles_parallel<Spec>(
+          world, dish2::cfg.INTROSPECTION_THREADS()
+        );
+    }
+  );
 
-  {
-    metric = "Number Unique Module Expression Profiles";
-    value = dish2::count_unique_module_expression_profiles<Spec>( world );
-    file.Update();
-  }
+  scan.AddComputed( "Number Unique Module Expression Profiles",
+    [&sketches]( const world_t& world, const scan_t& ){
+      return sketches
+        ? sketches->EstimateNumModuleExpressionProfiles()
+        : dish2::count_unique_module_expression_profiles_parallel<Spec>(
+          world, dish2::cfg.INTROSPECTION_THREADS()
+        );
+    }
+  );
 
+  scan.AddMeanPerCell( "Mean Resource Stockpile", live_cells,
+    []( const cell_t& cell ){
+      return first_cardinal< dish2::ResourceStockpileWrapper<Spec> >(
+        cell
+      ).Get();
+    }
+  );
 
-  {
-    metric = "Mean Resource Stockpile";
-    value = dish2::get_mean_resource_stockpile<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Fecund Resource Stockpile Fraction", live_cells,
+    []( const cell_t& cell ){
+      return first_cardinal< dish2::ResourceStockpileWrapper<Spec> >(
+        cell
+      ).Get() >= 1.0;
+    }
+  );
 
-  {
-    metric = "Fecund Resource Stockpile Fraction";
-    value = dish2::get_fraction_fecund_resource_stockpile<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerLiveCardinal( "Resource Receiving Cardinal Fraction",
+    count_cardinals_if< dish2::ResourceInputPeekWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Resource Receiving Cardinal Fraction";
-    value = dish2::get_fraction_cardinals_receiving_resource<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Resource Receiving Cell Fraction", live_cells,
+    any_cardinal< dish2::ResourceInputPeekWrapper<Spec>, cell_t >
+  );
 
+  scan.AddMeanPerLiveCardinal( "Mean Resource Received Per Cardinal",
+    sum_cardinals< dish2::ResourceInputPeekWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Resource Receiving Cell Fraction";
-    value = dish2::get_fraction_cells_receiving_resource<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Mean Resource Received Per Cell", live_cells,
+    sum_cardinals< dish2::ResourceInputPeekWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Mean Resource Received Per Cardinal";
-    value = dish2::get_mean_resource_received_per_cardinal<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerLiveCardinal( "Resource Send Request Cardinal Fraction",
+    count_cardinals_if< dish2::ResourceSendRequestWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Mean Resource Received Per Cell";
-    value = dish2::get_mean_resource_received_per_cell<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Resource Send Request Cell Fraction", live_cells,
+    any_cardinal< dish2::ResourceSendRequestWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Resource Send Request Cardinal Fraction";
-    value = dish2::get_fraction_cardinals_resource_send_request<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerLiveCardinal( "Resource Reserve Request Cardinal Fraction",
+    count_cardinals_if< dish2::ResourceReserveRequestWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Resource Send Request Cell Fraction";
-    value = dish2::get_fraction_cells_resource_send_request<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Resource Reserve Request Cell Fraction", live_cells,
+    any_cardinal< dish2::ResourceReserveRequestWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Resource Reserve Request Cardinal Fraction";
-    value = dish2::get_fraction_cardinals_resource_reserve_request<Spec>(
-      world
-    );
-    file.Update();
-  }
+  scan.AddMeanPerLiveCardinal(
+    "Resource Receive Resistance Cardinal Fraction",
+    count_cardinals_if<
+      dish2::ResourceReceiveResistanceWrapper<Spec>, cell_t
+    >
+  );
 
+  scan.AddMeanPerCell(
+    "Resource Receive Resistance Cell Fraction", live_cells,
+    any_cardinal< dish2::ResourceReceiveResistanceWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Resource Reserve Request Cell Fraction";
-    value = dish2::get_fraction_cells_resource_reserve_request<Spec>(
-      world
-    );
-    file.Update();
-  }
+  scan.AddMeanPerLiveCardinal( "Spawn Arrest Cardinal Fraction",
+    count_cardinals_if< dish2::SpawnArrestWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Resource Receive Resistance Cardinal Fraction";
-    value = dish2::get_fraction_cardinals_resource_recieve_resistance<Spec>(
-      world
-    );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Spawn Arrest Cell Fraction", live_cells,
+    any_cardinal< dish2::SpawnArrestWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Resource Receive Resistance Cell Fraction";
-    value = dish2::get_fraction_cells_resource_recieve_resistance<Spec>(world);
-    file.Update();
-  }
+  scan.AddMeanPerLiveCardinal( "Spawn Request Cardinal Fraction",
+    count_cardinals_if< dish2::SpawnRequestWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Spawn Arrest Cardinal Fraction";
-    value = dish2::get_fraction_cardinals_spawn_arrest<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Spawn Request Cell Fraction", live_cells,
+    any_cardinal< dish2::SpawnRequestWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Spawn Arrest Cell Fraction";
-    value = dish2::get_fraction_cells_spawn_arrest<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Nulliparous Fraction", live_cells,
+    []( const cell_t& cell ){
+      return first_cardinal< dish2::SpawnCountWrapper<Spec> >(
+        cell
+      ).Get() == 0;
+    }
+  );
 
-  {
-    metric = "Spawn Request Cardinal Fraction";
-    value = dish2::get_fraction_cardinals_spawn_request<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Mean Spawn Count", live_cells,
+    []( const cell_t& cell ){
+      return first_cardinal< dish2::SpawnCountWrapper<Spec> >( cell ).Get();
+    }
+  );
 
-  {
-    metric = "Spawn Request Cell Fraction";
-    value = dish2::get_fraction_cells_spawn_request<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerLiveCardinal( "Cardinal Apoptosis Request Fraction",
+    count_cardinals_if< dish2::ApoptosisRequestWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Nulliparous Fraction";
-    value = dish2::get_fraction_nulliparous<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Cell Apoptosis Request Fraction", live_cells,
+    any_cardinal< dish2::ApoptosisRequestWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Mean Spawn Count";
-    value = dish2::get_mean_spawn_count<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerLiveCardinal(
+    "Mean Incoming Intra Message Count Per Cardinal",
+    sum_cardinals< dish2::IncomingIntraMessageCounterWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Cardinal Apoptosis Request Fraction";
-    value = dish2::get_fraction_cardinals_apoptosis_request<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell(
+    "Mean Incoming Intra Message Count Per Cell", live_cells,
+    sum_cardinals< dish2::IncomingIntraMessageCounterWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Cell Apoptosis Request Fraction";
-    value = dish2::get_fraction_cells_apoptosis_request<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerLiveCardinal(
+    "Mean Incoming Inter Message Count Per Cardinal",
+    sum_cardinals< dish2::IncomingInterMessageCounterWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Mean Incoming Intra Message Count Per Cardinal";
-    value = dish2::get_mean_incoming_intra_message_count_per_cardinal<Spec>(
-      world
-    );
-    file.Update();
-  }
+  scan.AddMeanPerCell(
+    "Mean Incoming Inter Message Count Per Cell", live_cells,
+    sum_cardinals< dish2::IncomingInterMessageCounterWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Mean Incoming Intra Message Count Per Cell";
-    value = dish2::get_mean_incoming_intra_message_count_per_cell<Spec>(
-      world
-    );
-    file.Update();
-  }
+  scan.AddMeanPerLiveCardinal( "Incoming Intra Message Cardinal Fraction",
+    count_cardinals_if<
+      dish2::IncomingIntraMessageCounterWrapper<Spec>, cell_t
+    >
+  );
 
-  {
-    metric = "Mean Incoming Inter Message Count Per Cardinal";
-    value = dish2::get_mean_incoming_inter_message_count_per_cardinal<Spec>(
-      world
-    );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Incoming Intra Message Cell Fraction", live_cells,
+    any_cardinal< dish2::IncomingIntraMessageCounterWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Mean Incoming Inter Message Count Per Cell";
-    value = dish2::get_mean_incoming_inter_message_count_per_cell<Spec>(
-      world
-    );
-    file.Update();
-  }
+  scan.AddMeanPerLiveCardinal( "Incoming Inter Message Cardinal Fraction",
+    count_cardinals_if<
+      dish2::IncomingInterMessageCounterWrapper<Spec>, cell_t
+    >
+  );
 
-  {
-    metric = "Incoming Intra Message Cardinal Fraction";
-    value = dish2::get_fraction_cardinals_incoming_intra_message<Spec>( world );
-    file.Update();
-  }
+  scan.AddMeanPerCell( "Incoming Inter Message Cell Fraction", live_cells,
+    any_cardinal< dish2::IncomingInterMessageCounterWrapper<Spec>, cell_t >
+  );
 
-  {
-    metric = "Incoming Intra Message Cell Fraction";
-    value = dish2::get_fraction_cells_incoming_intra_message<Spec>( world );
-    file.Update();
-  }
+  for ( const auto cause : magic_enum::enum_values<dish2::CauseOfDeath>() ) {
 
-  {
-    metric = "Incoming Inter Message Cardinal Fraction";
-    value = dish2::get_fraction_cardinals_incoming_inter_message<Spec>( world );
-    file.Update();
-  }
+    const auto num_deaths = [cause]( const world_t& world ){
+      return static_cast<double>( world.template GetRunningLogSummary<
+        dish2::DeathEvent<Spec>
+      >().GetSize( cause ) );
+    };
+    const std::string k{ magic_enum::enum_name( cause ) };
 
-  {
-    metric = "Incoming Inter Message Cell Fraction";
-    value = dish2::get_fraction_cells_incoming_inter_message<Spec>( world );
-    file.Update();
-  }
+    scan.AddComputed( emp::to_string("Num Deaths ", k),
+      [=]( const world_t& world, const scan_t& ){
+        return num_deaths( world );
+      }
+    );
 
-  for (
-    const auto& [k, v]
-    : dish2::make_causes_of_death_string_histogram<dish2::ThreadWorld<Spec>>(
-      world
-    )
-  ) {
+    scan.AddComputed( emp::to_string("Fraction Deaths ", k),
+      [=]( const world_t& world, const scan_t& ){
+        return num_deaths( world )
+          / dish2::count_death_events<Spec>( world );
+      }
+    );
+
+    scan.AddComputed( emp::to_string("Num Deaths per Cell-update ", k),
+      [=]( const world_t& world, const scan_t& ){
+        return num_deaths( world ) / num_cell_updates( world );
+      }
+    );
 
-    {
-      metric = emp::to_string("Num Deaths ", k);
-      value = v;
-      file.Update();
+    scan.AddComputed( emp::to_string("Num Deaths per Live Cell-update ", k),
+      [=]( const world_t& world, const scan_t& scan ){
+        return num_deaths( world ) / num_live_cell_updates( world, scan );
+      }
+    );
+
+  } // end loop over death enum
+
+  scan.AddComputed( "Num Deaths per Cell-update",
+    [=]( const world_t& world, const scan_t& ){
+      return dish2::count_death_events<Spec>( world )
+        / num_cell_updates( world );
     }
+  );
 
-    {
-      metric = emp::to_string("Fraction Deaths ", k);
-      value = v / static_cast<double>( dish2::count_death_events<Spec>( world ) );
-      file.Update();
+  scan.AddComputed( "Num Deaths per Live Cell-update ",
+    [=]( const world_t& world, const scan_t& scan ){
+      return dish2::count_death_events<Spec>( world )
+        / num_live_cell_updates( world, scan );
     }
+  );
 
+  scan.AddComputed( "Num Births per Cell-update",
+    [=]( const world_t& world, const scan_t& ){
+      return dish2::count_birth_events<Spec>( world )
+        / num_cell_updates( world );
+    }
+  );
 
-    {
-      metric = emp::to_string("Num Deaths per Cell-update ", k);
-      value = v / static_cast<double>(
-        dish2::get_num_running_log_cell_updates<Spec>( world )
-      );
-      file.Update();
+  scan.AddComputed( "Num Births per Live Cell-update ",
+    [=]( const world_t& world, const scan_t& scan ){
+      return dish2::count_birth_events<Spec>( world )
+        / num_live_cell_updates( world, scan );
     }
+  );
 
-    {
-      metric = emp::to_string("Num Deaths per Live Cell-update ", k);
-      value = v / static_cast<double>(
-        dish2::get_num_running_log_live_cell_updates<Spec>( world )
-      );
-      file.Update();
+  scan.AddComputed( "Num Spawn Events per Cell-update",
+    [=]( const world_t& world, const scan_t& ){
+      return dish2::count_spawn_events<Spec>( world )
+        / num_cell_updates( world );
     }
+  );
 
-  } // end loop over death enum
+  scan.AddComputed( "Num Spawn Events per Live Cell-update ",
+    [=]( const world_t& world, const scan_t& scan ){
+      return dish2::count_spawn_events<Spec>( world )
+        / num_live_cell_updates( world, scan );
+    }
+  );
 
-  {
-    metric = emp::to_string("Num Deaths per Cell-update");
-    value = dish2::count_death_events<Spec>( world ) / static_cast<double>(
-      dish2::get_num_running_log_cell_updates<Spec>( world )
+  for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+    scan.AddMeanPerLiveCardinal(
+      emp::to_string("Fraction Neighbors Kin Level ", lev),
+      [lev]( const cell_t& cell ){
+        emp_assert( cell.GetNumCardinals() >= cell.GetPeripherality( lev ) );
+        return cell.GetNumCardinals() - cell.GetPeripherality( lev );
+      }
     );
-    file.Update();
   }
 
-  {
-    metric = emp::to_string("Num Deaths per Live Cell-update ");
-    value = dish2::count_death_events<Spec>( world ) / static_cast<double>(
-      dish2::get_num_running_log_live_cell_updates<Spec>( world )
+  // kin group size metrics share one tally, run alongside the scan
+  for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+    scan.AddComputed( emp::to_string("Mean Kin Group Size Level ", lev),
+      [lev, &kin_group_size_stats]( const world_t&, const scan_t& ){
+        return kin_group_size_stats.GetMaximumSize( lev );
+      }
     );
-    file.Update();
   }
 
-  {
-    metric = emp::to_string("Num Births per Cell-update");
-    value = dish2::count_birth_events<Spec>( world ) / static_cast<double>(
-      dish2::get_num_running_log_cell_updates<Spec>( world )
+  for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+    scan.AddComputed( emp::to_string("Mean Kin Group Size Level ", lev),
+      [lev, &kin_group_size_stats]( const world_t&, const scan_t& ){
+        return kin_group_size_stats.GetMeanSize( lev );
+      }
     );
-    file.Update();
   }
 
-  {
-    metric = emp::to_string("Num Births per Live Cell-update ");
-    value = dish2::count_birth_events<Spec>( world ) / static_cast<double>(
-      dish2::get_num_running_log_live_cell_updates<Spec>( world )
+  for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+    scan.AddComputed( emp::to_string("Median Kin Group Size Level ", lev),
+      [lev, &kin_group_size_stats]( const world_t&, const scan_t& ){
+        return kin_group_size_stats.GetMedianSize( lev );
+      }
     );
-    file.Update();
   }
 
-  {
-    metric = emp::to_string("Num Spawn Events per Cell-update");
-    value = dish2::count_spawn_events<Spec>( world ) / static_cast<double>(
-      dish2::get_num_running_log_cell_updates<Spec>( world )
+  for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+    scan.AddComputed(
+      emp::to_string("Fraction Kin Group Loner Cells Level ", lev),
+      [lev, &kin_group_size_stats]( const world_t&, const scan_t& ){
+        return kin_group_size_stats.GetFractionCellsLoners( lev );
+      }
     );
-    file.Update();
   }
 
-  {
-    metric = emp::to_string("Num Spawn Events per Live Cell-update ");
-    value = dish2::count_spawn_events<Spec>( world ) / static_cast<double>(
-      dish2::get_num_running_log_live_cell_updates<Spec>( world )
+  scan.Add( "Mean Instructions Executed per Cardinal-update", all_cells,
+    sum_cardinals< dish2::EntireElapsedInstructionCyclesWrapper<Spec>, cell_t >,
+    []( const double num_cycles, const scan_t& scan ){
+      return num_cycles / scan.GetNumCardinalUpdates();
+    }
+  );
+
+  scan.Add( "Num Instructions Executed per Live Cardinal-update", all_cells,
+    sum_cardinals< dish2::EntireElapsedInstructionCyclesWrapper<Spec>, cell_t >,
+    []( const double num_cycles, const scan_t& scan ){
+      return num_cycles / scan.GetNumLiveCardinalUpdates();
+    }
+  );
+
+}
+
+/// @return analyses from this write, for global reduction.
+template< typename Spec, typename DataFile >
+const dish2::internal::DemographicPhenotypicPhylogeneticMetricsState< Spec >&
+write_demographic_phenotypic_phylogenetic_metrics(
+  const dish2::ThreadWorld< Spec >& world,
+  const size_t thread_idx,
+  DataFile& file
+) {
+
+  // thread_local statics are separate for each DataFile type
+  thread_local std::string metric;
+  thread_local double value;
+  thread_local size_t update;
+
+  update = world.GetUpdate();
+
+  thread_local dish2::internal::DemographicPhenotypicPhylogeneticMetricsState<
+    Spec
+  > state;
+
+  thread_local std::once_flag once_flag;
+  std::call_once(once_flag, [thread_idx, &file](){
+    if ( dish2::has_stint() ) file.AddVal(cfg.STINT(), "Stint");
+    if ( dish2::has_series() ) file.AddVal(cfg.SERIES(), "Series");
+    if ( dish2::has_replicate() ) file.AddVal(cfg.REPLICATE(), "Replicate");
+
+    file.AddVar(metric, "Metric");
+    file.AddVar(value, "Value");
+    file.AddVar(update, "Update");
+    file.PrintHeaderKeys();
+
+    if ( cfg.DISTINCT_COUNT_SKETCH_PRECISION() ) state.sketches.emplace(
+      cfg.DISTINCT_COUNT_SKETCH_PRECISION()
     );
+    dish2::internal::register_demographic_phenotypic_phylogenetic_metrics<
+      Spec
+    >( state );
+
+    std::cout << "proc " << uitsl::get_proc_id() << " thread " << thread_idx
+      << " wrote demographic phenotypic phylogenetic metrics" << std::endl;
+  });
+
+  state.kin_group_size_stats.Run( world );
+  if ( state.sketches ) state.sketches->Run(
+    world, cfg.INTROSPECTION_THREADS()
+  );
+  state.scan.Run( world );
+  for ( const auto& [name, result] : state.scan.GetResults() ) {
+    metric = name;
+    value = result;
     file.Update();
   }
 
-  for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+  // COMMUNICATION METRICS
+  // tallies accumulate since previous write on this thread
 
-    const size_t num_kin_neighbors
-      = dish2::count_kin_neighbors<Spec>( world, lev );
-    const size_t num_neighbors = dish2::count_live_cardinals<Spec>( world );
+  const auto write_put_tally = [&file](
+    const std::string& mesh, auto& tally
+  ){
 
-    metric = emp::to_string("Fraction Neighbors Kin Level ", lev);
-    value = num_kin_neighbors / static_cast<double>( num_neighbors );
+    metric = emp::to_string( mesh, " Mesh Put Attempts" );
+    value = tally.GetNumAttempts();
     file.Update();
 
-  }
+    metric = emp::to_string( mesh, " Mesh Put Drop Fraction" );
+    value = tally.GetDropFraction();
+    file.Update();
 
-  for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+    tally.Reset();
 
-    metric = emp::to_string("Mean Kin Group Size Level ", lev);
-    value = dish2::get_maximum_kin_group_size<Spec>( world, lev );
-    file.Update();
+  };
 
-  }
+  write_put_tally( "Genome", dish2::MeshPutTally<
+    typename Spec::genome_mesh_spec_t
+  >::Get() );
+  write_put_tally( "Intra Message", dish2::MeshPutTally<
+    typename Spec::intra_message_mesh_spec_t
+  >::Get() );
+  write_put_tally( "Message", dish2::MeshPutTally<
+    typename Spec::message_mesh_spec_t
+  >::Get() );
+  write_put_tally( "Quorum", dish2::MeshPutTally<
+    typename Spec::quorum_mesh_spec_t
+  >::Get() );
+  write_put_tally( "Resource", dish2::MeshPutTally<
+    typename Spec::resource_mesh_spec_t
+  >::Get() );
+  write_put_tally( "State", dish2::MeshPutTally<
+    typename Spec::state_mesh_spec_t
+  >::Get() );
 
-  for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+  return state;
 
-    metric = emp::to_string("Mean Kin Group Size Level ", lev);
-    value = dish2::get_mean_kin_group_size<Spec>( world, lev );
-    file.Update();
+}
 
-  }
+template< typename Spec, typename DataFile >
+void write_global_demographic_phenotypic_phylogenetic_metrics(
+  const dish2::FusedPopulationScan< Spec >& global_scan,
+  const emp::optional< dish2::DistinctCountSketches< Spec > >& global_sketches,
+  DataFile& file
+) {
 
-  for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+  // thread_local statics are separate for each DataFile type
+  thread_local std::string metric;
+  thread_local double value;
+  thread_local size_t update;
 
-    metric = emp::to_string("Median Kin Group Size Level ", lev);
-    value = dish2::get_median_kin_group_size<Spec>( world, lev );
-    file.Update();
+  update = global_scan.GetUpdate();
 
-  }
+  thread_local std::once_flag once_flag;
+  std::call_once(once_flag, [&file](){
+    if ( dish2::has_stint() ) file.AddVal(cfg.STINT(), "Stint");
+    if ( dish2::has_series() ) file.AddVal(cfg.SERIES(), "Series");
+    if ( dish2::has_replicate() ) file.AddVal(cfg.REPLICATE(), "Replicate");
 
-  for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+    file.AddVar(metric, "Metric");
+    file.AddVar(value, "Value");
+    file.AddVar(update, "Update");
+    file.PrintHeaderKeys();
 
-    metric = emp::to_string("Fraction Kin Group Loner Cells Level ", lev);
-    value = dish2::get_fraction_cells_kin_group_loners<Spec>( world, lev );
-    file.Update();
+    std::cout << "proc " << uitsl::get_proc_id()
+      << " wrote global demographic phenotypic phylogenetic metrics"
+      << std::endl;
+  });
 
+  const auto& results = global_scan.GetResults();
+  for ( size_t idx{}; idx < results.size(); ++idx ) {
+    if ( !global_scan.IsMergeable( idx ) ) continue;
+    metric = results[ idx ].first;
+    value = results[ idx ].second;
+    file.Update();
   }
 
-  {
-    metric = "Mean Instructions Executed per Cardinal-update";
-    const size_t num_cardinal_updates
-      = dish2::count_cardinals<Spec>( world ) * world.GetUpdate();
-    value = dish2::sum_entire_elapsed_instruction_cycles<Spec>( world )
-      / static_cast<double>( num_cardinal_updates );
+  if ( !global_sketches ) return;
+
+  const auto write_estimate = [&file](
+    const std::string& name, const double estimate
+  ){
+    metric = name;
+    value = estimate;
     file.Update();
+  };
+
+  write_estimate(
+    "Number Phylogenetic Roots", global_sketches->EstimateNumRootIDs()
+  );
+  write_estimate(
+    "Number Stint Phylogenetic Roots",
+    global_sketches->EstimateNumStintRootIDs()
+  );
+  write_estimate(
+    "Number Unique Genotypes", global_sketches->EstimateNumCodingGenotypes()
+  );
+  write_estimate(
+    "Number Unique Module Regulation Profiles",
+    global_sketches->EstimateNumModuleRegulationProfiles()
+  );
+  write_estimate(
+    "Number Unique Module Expression Profiles",
+    global_sketches->EstimateNumModuleExpressionProfiles()
+  );
+
+}
+
+} // namespace internal
+
+/// Sum per-cell metric partial sums across all threads and processes and
+/// write merged metrics from proc 0 thread 0.
+/// Distinct count sketches, if any, are merged too.
+/// Collective: every simulation thread of every process must call.
+template< typename Spec >
+void write_global_demographic_phenotypic_phylogenetic_metrics(
+  const dish2::internal::DemographicPhenotypicPhylogeneticMetricsState<
+    Spec
+  >& state,
+  const size_t thread_idx
+) {
+
+  static dish2::GlobalAllreduce< double > reduce_sums(
+    MPI_DOUBLE, MPI_SUM, std::plus< double >{}
+  );
+  static dish2::GlobalAllreduce< uint8_t > reduce_registers(
+    MPI_UINT8_T, MPI_MAX,
+    []( const uint8_t a, const uint8_t b ){ return std::max( a, b ); }
+  );
+
+  static dish2::GlobalAllreduce< uint64_t > reduce_update(
+    MPI_UINT64_T, MPI_MIN,
+    []( const uint64_t a, const uint64_t b ){ return std::min( a, b ); }
+  );
+
+  const auto partial_sums = reduce_sums( state.scan.GetPartialSums() );
+  // report the latest update every thread has reached
+  const uint64_t update = reduce_update(
+    { uint64_t{ state.scan.GetUpdate() } }
+  ).front();
+
+  // precision is uniform, so every thread takes the same branch
+  emp::optional< dish2::DistinctCountSketches< Spec > > global_sketches;
+  if ( state.sketches ) global_sketches.emplace(
+    dish2::DistinctCountSketches< Spec >::FromRegisters(
+      reduce_registers( state.sketches->GetRegisters() )
+    )
+  );
+
+  if ( uitsl::get_proc_id() || thread_idx ) return;
+
+  // copy registered metrics from this thread's scan
+  thread_local dish2::FusedPopulationScan< Spec > global_scan( state.scan );
+  global_scan.Merge( partial_sums, update );
+
+  const thread_local std::string out_filename = dish2::pare_keyname_filename(
+    dish2::make_global_demographic_phenotypic_phylogenetic_metrics_filename(),
+    dish2::make_data_path()
+  );
+
+  if ( cfg.DATA_COLUMNAR() ) {
+    thread_local dish2::ColumnarDataFile file(
+      dish2::make_data_path( out_filename ),
+      cfg.DATA_COLUMNAR_ROW_GROUP_SIZE(),
+      cfg.DATA_COLUMNAR_LEVEL()
+    );
+    dish2::internal::write_global_demographic_phenotypic_phylogenetic_metrics<
+      Spec
+    >( global_scan, global_sketches, file );
+  } else {
+    thread_local emp::DataFile file( dish2::make_data_path(
+      out_filename
+    ) );
+    dish2::internal::write_global_demographic_phenotypic_phylogenetic_metrics<
+      Spec
+    >( global_scan, global_sketches, file );
   }
 
-  {
-    metric = "Num Instructions Executed per Live Cardinal-update";
-    const size_t num_live_cardinal_updates
-      = dish2::count_live_cardinals<Spec>( world ) * world.GetUpdate();
-      value = dish2::sum_entire_elapsed_instruction_cycles<Spec>( world )
-        / static_cast<double>( num_live_cardinal_updates );
-    file.Update();
+}
+
+template< typename Spec >
+void write_demographic_phenotypic_phylogenetic_metrics(
+  const dish2::ThreadWorld< Spec >& world, const size_t thread_idx
+) {
+
+  const thread_local std::string out_filename = dish2::pare_keyname_filename(
+    dish2::make_demographic_phenotypic_phylogenetic_metrics_filename(
+      thread_idx
+    ),
+    dish2::make_data_path()
+  );
+
+  const dish2::internal::DemographicPhenotypicPhylogeneticMetricsState<
+    Spec
+  >* state;
+  if ( cfg.DATA_COLUMNAR() ) {
+    thread_local dish2::ColumnarDataFile file(
+      dish2::make_data_path( out_filename ),
+      cfg.DATA_COLUMNAR_ROW_GROUP_SIZE(),
+      cfg.DATA_COLUMNAR_LEVEL()
+    );
+    state = &dish2::internal::write_demographic_phenotypic_phylogenetic_metrics<
+      Spec
+    >( world, thread_idx, file );
+  } else {
+    thread_local emp::DataFile file( dish2::make_data_path(
+      out_filename
+    ) );
+    state = &dish2::internal::write_demographic_phenotypic_phylogenetic_metrics<
+      Spec
+    >( world, thread_idx, file );
+  }
+
+  // reductions are collective, so all threads and processes must write the
+  // same number of times
+  emp_always_assert(
+    !cfg.DATA_GLOBAL_METRICS() || !cfg.RUN_SECONDS()
+      || ( !uitsl::is_multiprocess() && cfg.N_THREADS() == 1 ),
+    "DATA_GLOBAL_METRICS with multiple threads or processes requires "
+    "RUN_SECONDS 0"
+  );
+
+  if ( cfg.DATA_GLOBAL_METRICS() ) {
+    dish2::write_global_demographic_phenotypic_phylogenetic_metrics<Spec>(
+      *state, thread_idx
+    );
   }
 
 }
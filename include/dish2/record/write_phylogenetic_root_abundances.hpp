@@ -5,14 +5,17 @@
 #include <mutex>
 #include <string>
 
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
 #include "../../../third-party/Empirical/include/emp/data/DataFile.hpp"
 
 #include "../config/has_replicate.hpp"
 #include "../config/has_series.hpp"
 #include "../config/has_stint.hpp"
 #include "../introspection/get_root_id_abundance.hpp"
+#include "../introspection/get_root_id_count.hpp"
 #include "../introspection/get_root_id_prevalence.hpp"
 #include "../introspection/get_unique_root_ids.hpp"
+#include "../phylogeny/RootAbundanceTable.hpp"
 #include "../utility/pare_keyname_filename.hpp"
 
 #include "make_filename/make_data_path.hpp"
@@ -57,12 +60,27 @@ void write_phylogenetic_root_abundances(
       << " wrote phylogenetic root abundances" << std::endl;
   });
 
-  for ( const auto& root_id_ : dish2::get_unique_root_ids<Spec>(world) ) {
-    root_id = root_id_;
-    abundance = dish2::get_root_id_abundance<Spec>( root_id, world );
-    count = dish2::get_root_id_count<Spec>( root_id, world );
-    prevalence = dish2::get_root_id_prevalence<Spec>( root_id, world );
-    file.Update();
+  const auto& table = dish2::RootAbundanceTable::Get();
+  if ( table.IsOpenFor( world ) ) {
+    emp_assert(
+      table.GetNumRoots() == dish2::get_unique_root_ids<Spec>( world ).size()
+    );
+    for ( const auto& [root_id_, count_] : table.GetSortedCounts() ) {
+      root_id = root_id_;
+      count = count_;
+      abundance = count / static_cast<double>( world.GetSize() );
+      prevalence = count / static_cast<double>( table.GetNumLiveCells() );
+      file.Update();
+    }
+  } else {
+    // table not tracking this world, so rescan population for each root
+    for ( const auto& root_id_ : dish2::get_unique_root_ids<Spec>(world) ) {
+      root_id = root_id_;
+      abundance = dish2::get_root_id_abundance<Spec>( root_id, world );
+      count = dish2::get_root_id_count<Spec>( root_id, world );
+      prevalence = dish2::get_root_id_prevalence<Spec>( root_id, world );
+      file.Update();
+    }
   }
 
 }
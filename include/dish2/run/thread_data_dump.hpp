@@ -2,11 +2,16 @@
 #ifndef DISH2_RUN_THREAD_DATA_DUMP_HPP_INCLUDE
 #define DISH2_RUN_THREAD_DATA_DUMP_HPP_INCLUDE
 
+#include <functional>
+#include <future>
 #include <limits>
 
 #include "../../../third-party/conduit/include/uitsl/countdown/Timer.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
 
 #include "../config/cfg.hpp"
+#include "../phylogeny/PhylogenyTracker.hpp"
+#include "../record/AsyncDumpQueue.hpp"
 #include "../record/dump_abundance_genome.hpp"
 #include "../record/dump_arbitrary_genome.hpp"
 #include "../record/dump_birth_log.hpp"
@@ -14,6 +19,7 @@
 #include "../record/dump_death_log.hpp"
 #include "../record/dump_kin_conflict_by_replev_statistics.hpp"
 #include "../record/dump_kin_conflict_statistics.hpp"
+#include "../record/dump_phylogeny.hpp"
 #include "../record/dump_population.hpp"
 #include "../record/dump_spawn_log.hpp"
 #include "../world/ThreadWorld.hpp"
@@ -27,19 +33,53 @@ void thread_data_dump(
   const size_t thread_idx
 ) {
 
+  emp::vector< std::function<void()> > dumpers;
 
-  if (dish2::cfg.GENESIS() == "innoculate") {
+  if (dish2::cfg.GENESIS() == "innoculate") dumpers.push_back( [&](){
     dish2::dump_coalescence_result<Spec>( thread_world, thread_idx );
+  } );
+  dumpers.push_back( [&](){
+    dish2::dump_kin_conflict_by_replev_statistics<Spec>(
+      thread_world, thread_idx
+    );
+  } );
+  dumpers.push_back( [&](){
+    dish2::dump_kin_conflict_statistics<Spec>(
+      thread_world, thread_idx
+    );
+  } );
+  dumpers.push_back( [&](){
+    dish2::dump_birth_log<Spec>( thread_world, thread_idx );
+  } );
+  dumpers.push_back( [&](){
+    dish2::dump_death_log<Spec>( thread_world, thread_idx );
+  } );
+  dumpers.push_back( [&](){
+    dish2::dump_spawn_log<Spec>( thread_world, thread_idx );
+  } );
+  // tracker is thread local, so bind this thread's instance
+  dumpers.push_back( [&, &tracker = dish2::PhylogenyTracker::Get()](){
+    dish2::dump_phylogeny( tracker, thread_idx );
+  } );
+
+  if ( !dish2::cfg.DATA_DUMP_PARALLEL() ) {
+    for ( const auto& dumper : dumpers ) dumper();
+    return;
   }
-  dish2::dump_kin_conflict_by_replev_statistics<Spec>(
-    thread_world, thread_idx
-  );
-  dish2::dump_kin_conflict_statistics<Spec>(
-    thread_world, thread_idx
-  );
-  dish2::dump_birth_log<Spec>( thread_world, thread_idx );
-  dish2::dump_death_log<Spec>( thread_world, thread_idx );
-  dish2::dump_spawn_log<Spec>( thread_world, thread_idx );
+
+  // dumpers only read from the world, so they can run concurrently
+  // (their compression shares dish2::get_dump_compression_budget)
+  emp::vector< std::future<void> > pending;
+  for ( const auto& dumper : dumpers ) pending.push_back( std::async(
+    std::launch::async, [&dumper](){
+      dumper();
+      // finish any background writes before this pool thread exits
+      dish2::AsyncDumpQueue::Get().Wait();
+    }
+  ) );
+
+  // rethrows any exception from a dumper
+  for ( auto& future : pending ) future.get();
 
 }
 
@@ -7,8 +7,13 @@
 #include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
 
 #include "../config/cfg.hpp"
+#include "../phylogeny/PhylogenyTracker.hpp"
+#include "../phylogeny/RootAbundanceTable.hpp"
 #include "../load/load_world.hpp"
+#include "../record/AsyncDumpQueue.hpp"
+#include "../record/dump_checkpoint.hpp"
 #include "../record/make_filename/make_elapsed_updates_filename.hpp"
+#include "../runninglog/EventStream.hpp"
 #include "../world/ThreadWorld.hpp"
 
 #include "thread_artifacts_dump.hpp"
@@ -24,6 +29,9 @@ void thread_job(
 ) {
 
   dish2::load_world<Spec>( thread_idx, thread_world );
+  dish2::EventStream<Spec>::Get().Open( thread_idx );
+  dish2::PhylogenyTracker::Get().Open( thread_world );
+  dish2::RootAbundanceTable::Get().Open( thread_world );
 
   if ( cfg.RUN() ) dish2::thread_evolve<Spec>( thread_idx, thread_world );
 
@@ -32,6 +40,10 @@ void thread_job(
     dish2::make_elapsed_updates_filename( thread_idx )
   ) << thread_world.GetUpdate() << std::endl;
 
+  if ( cfg.CHECKPOINT_DUMP() ) {
+    dish2::dump_checkpoint<Spec>( thread_world, thread_idx );
+  }
+
   if ( cfg.ARTIFACTS_DUMP() ) {
     dish2::thread_artifacts_dump<Spec>( thread_world, thread_idx );
     std::cout << "proc " << uitsl::get_proc_id() << " thread " << thread_idx
@@ -52,6 +64,9 @@ void thread_job(
       << " write 1" << std::endl;
   }
 
+  dish2::EventStream<Spec>::Get().Flush();
+  dish2::AsyncDumpQueue::Get().Wait();
+
   std::cout << "proc " << uitsl::get_proc_id() << " thread " << thread_idx
     << " thread job complete" << std::endl;
 
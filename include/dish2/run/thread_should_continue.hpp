@@ -9,7 +9,7 @@
 #include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
 
 #include "../config/cfg.hpp"
-#include "../introspection/has_coalesced.hpp"
+#include "../parallel/has_globally_coalesced.hpp"
 #include "../world/ThreadWorld.hpp"
 
 namespace dish2 {
@@ -22,14 +22,22 @@ bool thread_should_contine(
 
   const size_t update = thread_world.GetUpdate();
 
+  // coalescence checks are collective, so all threads and processes must
+  // stop at the same update
+  emp_always_assert(
+    !cfg.ABORT_IF_COALESCENT_FREQ() || !cfg.RUN_SECONDS()
+      || ( !uitsl::is_multiprocess() && cfg.N_THREADS() == 1 ),
+    "coalescence checks with multiple threads or processes require "
+    "RUN_SECONDS 0"
+  );
+
   if (
     cfg.ABORT_IF_COALESCENT_FREQ()
     && uitsl::shift_mod(update, cfg.ABORT_IF_COALESCENT_FREQ()) == 0
-    && dish2::has_coalesced<Spec>( thread_world )
+    && dish2::has_globally_coalesced<Spec>( thread_world )
   ) {
-    emp_always_assert( !uitsl::is_multiprocess() );
-    emp_always_assert( cfg.N_THREADS() == 1 );
-    std::cout << "coalescence detected at update " << update << std::endl;
+    std::cout << "proc " << uitsl::get_proc_id()
+      << " coalescence detected at update " << update << std::endl;
     std::cout << "aborting!";
     return false;
   } else if (
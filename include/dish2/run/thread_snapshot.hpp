@@ -0,0 +1,31 @@
+#pragma once
+#ifndef DISH2_RUN_THREAD_SNAPSHOT_HPP_INCLUDE
+#define DISH2_RUN_THREAD_SNAPSHOT_HPP_INCLUDE
+
+#include "../config/cfg.hpp"
+#include "../record/dump_checkpoint.hpp"
+#include "../record/dump_population.hpp"
+#include "../world/ThreadWorld.hpp"
+
+namespace dish2 {
+
+// data collection tasks that are run periodically mid-run
+template<typename Spec>
+void thread_snapshot(
+  const dish2::ThreadWorld<Spec>& thread_world,
+  const size_t thread_idx
+) {
+
+  if ( dish2::cfg.SNAPSHOT_POPULATION() ) dish2::dump_population<Spec>(
+    thread_world, thread_idx, true // snapshot
+  );
+
+  if ( dish2::cfg.SNAPSHOT_CHECKPOINT() ) dish2::dump_checkpoint<Spec>(
+    thread_world, thread_idx
+  );
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RUN_THREAD_SNAPSHOT_HPP_INCLUDE
@@ -2,6 +2,8 @@
 #ifndef DISH2_RUN_THREAD_STEP_HPP_INCLUDE
 #define DISH2_RUN_THREAD_STEP_HPP_INCLUDE
 
+#include <limits>
+
 #include "../../../third-party/conduit/include/uitsl/chrono/ClockDeltaDetector.hpp"
 #include "../../../third-party/conduit/include/uitsl/concurrent/ConcurrentBarrier.hpp"
 #include "../../../third-party/conduit/include/uitsl/countdown/Timer.hpp"
@@ -13,6 +15,7 @@
 
 #include "print_progress.hpp"
 #include "setup_thread_local_random.hpp"
+#include "thread_snapshot.hpp"
 
 namespace dish2 {
 
@@ -35,6 +38,20 @@ void thread_step(
       == 0
   ) dish2::write_phylogenetic_root_abundances<Spec>( thread_world, thread_idx );
 
+  if (
+    thread_local uitsl::CoarseTimer snapshot_timer{
+      dish2::cfg.SNAPSHOT_SECONDS() ?: std::numeric_limits<double>::infinity()
+    };
+    (
+      cfg.SNAPSHOT_FREQUENCY()
+      && uitsl::shift_mod( thread_world.GetUpdate(), cfg.SNAPSHOT_FREQUENCY() )
+        == 0
+    ) || snapshot_timer.IsComplete()
+  ) {
+    snapshot_timer.Reset();
+    dish2::thread_snapshot<Spec>( thread_world, thread_idx );
+  }
+
   // update the simulation
   thread_world.Update();
 
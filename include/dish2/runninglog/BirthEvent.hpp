@@ -2,6 +2,8 @@
 #ifndef DISH2_RUNNINGLOG_BIRTHEVENT_HPP_INCLUDE
 #define DISH2_RUNNINGLOG_BIRTHEVENT_HPP_INCLUDE
 
+#include "../../../third-party/cereal/include/cereal/cereal.hpp"
+#include "../../../third-party/cereal/include/cereal/types/array.hpp"
 #include "../../../third-party/Empirical/include/emp/base/array.hpp"
 
 namespace dish2 {
@@ -15,6 +17,15 @@ struct BirthEvent {
   emp::array<size_t, Spec::NLEV> peripherality_eliminated;
   size_t replev;
 
+  template <class Archive>
+  void serialize( Archive & ar ) { ar(
+    CEREAL_NVP( kin_id_commonality_daughter_eliminated ),
+    CEREAL_NVP( kin_id_commonality_parent_daughter ),
+    CEREAL_NVP( kin_id_commonality_parent_eliminated ),
+    CEREAL_NVP( peripherality_eliminated ),
+    CEREAL_NVP( replev )
+  ); }
+
 };
 
 } // namespace dish2
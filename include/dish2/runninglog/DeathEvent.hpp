@@ -4,6 +4,10 @@
 
 #include <deque>
 
+#include "../../../third-party/cereal/include/cereal/cereal.hpp"
+#include "../../../third-party/cereal/include/cereal/types/array.hpp"
+#include "../../../third-party/Empirical/include/emp/base/array.hpp"
+
 namespace dish2 {
 
 template< typename Spec >
@@ -12,6 +16,12 @@ struct DeathEvent {
   dish2::CauseOfDeath cause_of_death;
   emp::array<size_t, Spec::NLEV> peripherality_deceased;
 
+  template <class Archive>
+  void serialize( Archive & ar ) { ar(
+    CEREAL_NVP( cause_of_death ),
+    CEREAL_NVP( peripherality_deceased )
+  ); }
+
 };
 
 } // namespace dish2
@@ -0,0 +1,56 @@
+#pragma once
+#ifndef DISH2_RUNNINGLOG_DEATHEVENTSUMMARY_HPP_INCLUDE
+#define DISH2_RUNNINGLOG_DEATHEVENTSUMMARY_HPP_INCLUDE
+
+#include <cstddef>
+
+#include "../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../third-party/magic_enum/include/magic_enum.hpp"
+
+#include "../enum/CauseOfDeath.hpp"
+
+#include "DeathEvent.hpp"
+#include "RunningLogSummary.hpp"
+
+namespace dish2 {
+
+/// Tallies death events by cause.
+template< typename Spec >
+struct RunningLogSummary< dish2::DeathEvent<Spec> > {
+
+  using event_t = dish2::DeathEvent<Spec>;
+
+  size_t num_events{};
+  emp::array<
+    size_t, magic_enum::enum_count< dish2::CauseOfDeath >()
+  > num_events_by_cause{};
+
+  void Add( const event_t& event ) {
+    ++num_events;
+    ++num_events_by_cause[ static_cast<size_t>( event.cause_of_death ) ];
+  }
+
+  void Remove( const event_t& event ) {
+    --num_events;
+    --num_events_by_cause[ static_cast<size_t>( event.cause_of_death ) ];
+  }
+
+  RunningLogSummary& operator+=( const RunningLogSummary& other ) {
+    num_events += other.num_events;
+    for ( size_t i{}; i < num_events_by_cause.size(); ++i ) {
+      num_events_by_cause[i] += other.num_events_by_cause[i];
+    }
+    return *this;
+  }
+
+  size_t GetSize() const { return num_events; }
+
+  size_t GetSize( const dish2::CauseOfDeath cause ) const {
+    return num_events_by_cause[ static_cast<size_t>( cause ) ];
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RUNNINGLOG_DEATHEVENTSUMMARY_HPP_INCLUDE
@@ -0,0 +1,178 @@
+#pragma once
+#ifndef DISH2_RUNNINGLOG_EVENTSTREAM_HPP_INCLUDE
+#define DISH2_RUNNINGLOG_EVENTSTREAM_HPP_INCLUDE
+
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "../../../third-party/cereal/include/cereal/archives/binary.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+
+#include "../config/cfg.hpp"
+#include "../record/AsyncDumpQueue.hpp"
+#include "../record/make_filename/make_data_path.hpp"
+#include "../record/make_filename/make_event_stream_filename.hpp"
+#include "../utility/pare_keyname_filename.hpp"
+#include "../utility/xz_compress_parallel.hpp"
+
+#include "BirthEvent.hpp"
+#include "DeathEvent.hpp"
+#include "SpawnEvent.hpp"
+
+namespace dish2 {
+
+/// Append-only binary record of every birth, death, and spawn event on a
+/// thread, streamed to disk over the course of a run.
+/// Unlike `dish2::RunningLogs`, history is not purged.
+/// At most `max_backlog` flushed chunks await compression at a time, so
+/// memory use is bounded by about `max_backlog + 1` times
+/// `EVENT_STREAM_FLUSH_BYTES`.
+///
+/// File layout, after xz decompression: magic, version, and NLEV, then the
+/// payload size of each event type, then records until end of file.
+/// Each record is a uint8 event type (0 birth, 1 death, 2 spawn), a uint64
+/// update, a uint32 cell index, and the event in cereal binary encoding.
+template< typename Spec >
+class EventStream {
+
+  using birth_t = dish2::BirthEvent< Spec >;
+  using death_t = dish2::DeathEvent< Spec >;
+  using spawn_t = dish2::SpawnEvent< Spec >;
+
+  std::ostringstream buffer;
+  cereal::BinaryOutputArchive archive{ buffer };
+  // shared with background writes
+  std::shared_ptr< std::ofstream > out_stream;
+
+  // chunks enqueued but not yet written
+  struct Backlog {
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t num_chunks{};
+  };
+  std::shared_ptr< Backlog > backlog{ std::make_shared< Backlog >() };
+
+  uint64_t update{};
+  uint32_t cell_idx{};
+
+  EventStream() = default;
+
+  template< typename Event >
+  static uint32_t GetPayloadSize() {
+    std::ostringstream ss;
+    {
+      cereal::BinaryOutputArchive sizer( ss );
+      sizer( Event{} );
+    }
+    return ss.str().size();
+  }
+
+  template< typename Event >
+  static constexpr uint8_t GetEventType() {
+    if constexpr ( std::is_same_v< Event, birth_t > ) return 0;
+    else if constexpr ( std::is_same_v< Event, death_t > ) return 1;
+    else {
+      static_assert( std::is_same_v< Event, spawn_t > );
+      return 2;
+    }
+  }
+
+public:
+
+  static constexpr size_t max_backlog = 2;
+
+  static EventStream& Get() {
+    thread_local EventStream stream;
+    return stream;
+  }
+
+  EventStream( const EventStream& ) = delete;
+  EventStream& operator=( const EventStream& ) = delete;
+
+  bool IsOpen() const { return static_cast<bool>( out_stream ); }
+
+  /// Begin recording events. No-op if `EVENT_STREAM` is unset.
+  void Open( const size_t thread_idx ) {
+    if ( !dish2::cfg.EVENT_STREAM() || IsOpen() ) return;
+
+    const std::string out_filename = dish2::pare_keyname_filename(
+      dish2::make_event_stream_filename( thread_idx ),
+      dish2::make_data_path()
+    );
+    out_stream = std::make_shared< std::ofstream >(
+      dish2::make_data_path( out_filename ), std::ios::binary
+    );
+    emp_always_assert( *out_stream, out_filename );
+
+    buffer.write( "DISH2ES", 8 );
+    archive(
+      uint32_t{ 1 },
+      uint32_t{ Spec::NLEV },
+      GetPayloadSize< birth_t >(),
+      GetPayloadSize< death_t >(),
+      GetPayloadSize< spawn_t >()
+    );
+  }
+
+  /// Attribute subsequent events to this update and cell.
+  void SetContext( const size_t update_, const size_t cell_idx_ ) {
+    update = update_;
+    cell_idx = cell_idx_;
+  }
+
+  template< typename Event >
+  void Record( const Event& event ) {
+    if ( !IsOpen() ) return;
+
+    archive( GetEventType< Event >(), update, cell_idx, event );
+
+    const size_t num_buffered = buffer.tellp();
+    if ( num_buffered >= dish2::cfg.EVENT_STREAM_FLUSH_BYTES() ) Flush();
+  }
+
+  /// Compress and write buffered records in the background.
+  /// Blocks while `max_backlog` earlier chunks are still pending.
+  void Flush() {
+    if ( !IsOpen() || buffer.tellp() == 0 ) return;
+
+    {
+      std::unique_lock lock( backlog->mutex );
+      backlog->cv.wait(
+        lock, [this](){ return backlog->num_chunks < max_backlog; }
+      );
+      ++backlog->num_chunks;
+    }
+
+    std::string chunk = buffer.str();
+    buffer.str( {} );
+
+    dish2::AsyncDumpQueue::Get().Enqueue( [
+      stream = out_stream, backlog = backlog, chunk = std::move( chunk )
+    ](){
+      // appended xz streams concatenate into a valid xz file
+      const std::string compressed = dish2::xz_compress_parallel(
+        chunk, 6, 1
+      );
+      stream->write( compressed.data(), compressed.size() );
+      stream->flush();
+
+      {
+        const std::lock_guard lock( backlog->mutex );
+        --backlog->num_chunks;
+      }
+      backlog->cv.notify_one();
+    } );
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RUNNINGLOG_EVENTSTREAM_HPP_INCLUDE
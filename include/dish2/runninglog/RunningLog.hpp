@@ -2,54 +2,248 @@
 #ifndef DISH2_RUNNINGLOG_RUNNINGLOG_HPP_INCLUDE
 #define DISH2_RUNNINGLOG_RUNNINGLOG_HPP_INCLUDE
 
-#include <deque>
-#include <list>
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "../../../third-party/cereal/include/cereal/cereal.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
 
 #include "../config/cfg.hpp"
 
+#include "RunningLogArena.hpp"
+#include "RunningLogSummary.hpp"
+
 namespace dish2 {
 
+/// Events recorded over the last `RUNNING_LOG_DURATION` purges, iterated
+/// newest to oldest.
+/// Events are stored in a ring buffer drawn from a per-thread
+/// `dish2::RunningLogArena`.
+/// The buffer doubles when full and is returned to the arena once empty.
+/// A `dish2::RunningLogSummary` of retained events is kept up to date as
+/// events are recorded and purged.
 template<typename Event>
 class RunningLog {
 
-  // (FRONT) newest events -> oldest events (BACK)
-  std::deque<Event> events;
+  struct Entry {
+    Event event;
+    // value of purge counter when recorded
+    uint32_t epoch;
+  };
+
+  using arena_t = dish2::RunningLogArena< Entry >;
+  using summary_t = dish2::RunningLogSummary< Event >;
+
+  static constexpr size_t initial_capacity = 4;
+
+  Entry* buffer{ nullptr };
+  // always zero or a power of two
+  size_t capacity{};
+  // index one past newest entry
+  size_t head{};
+  size_t size{};
+  uint32_t epoch{};
+  summary_t summary{};
+
+  // k = 0 is newest entry
+  Entry& GetEntry( const size_t k ) const {
+    emp_assert( k < size, k, size );
+    return buffer[ ( head + capacity - 1 - k ) & ( capacity - 1 ) ];
+  }
+
+  Entry& GetOldest() const { return GetEntry( size - 1 ); }
+
+  void Grow() {
+    const size_t new_capacity = capacity ? 2 * capacity : initial_capacity;
+    Entry* new_buffer = arena_t::Acquire( new_capacity );
+
+    // lay out oldest to newest from start of new buffer
+    for ( size_t i{}; i < size; ++i ) {
+      Entry& entry = GetEntry( size - 1 - i );
+      new ( new_buffer + i ) Entry{ std::move( entry ) };
+      entry.~Entry();
+    }
+
+    if ( buffer ) arena_t::Release( buffer, capacity );
+    buffer = new_buffer;
+    capacity = new_capacity;
+    head = size & ( capacity - 1 );
+  }
+
+  void PopOldest() {
+    Entry& oldest = GetOldest();
+    summary.Remove( oldest.event );
+    oldest.~Entry();
+    --size;
+  }
+
+  void Clear() {
+    while ( size ) PopOldest();
+    if ( buffer ) arena_t::Release( buffer, capacity );
+    buffer = nullptr;
+    capacity = 0;
+    head = 0;
+  }
+
+  void Emplace( Event event, const uint32_t event_epoch ) {
+    if ( size == capacity ) Grow();
+    summary.Add( event );
+    new ( buffer + head ) Entry{ std::move( event ), event_epoch };
+    head = ( head + 1 ) & ( capacity - 1 );
+    ++size;
+  }
+
+  template< bool IsConst >
+  class Iterator {
+
+    using log_t = std::conditional_t< IsConst, const RunningLog, RunningLog >;
+
+    log_t* log{ nullptr };
+    size_t pos{};
+
+    friend class RunningLog;
+    template< bool > friend class Iterator;
+
+    Iterator( log_t* log_, const size_t pos_ ) : log( log_ ), pos( pos_ ) {}
+
+  public:
+
+    using value_type = Event;
+    using pointer = std::conditional_t< IsConst, const Event*, Event* >;
+    using reference = std::conditional_t< IsConst, const Event&, Event& >;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() = default;
+
+    // allow conversion from iterator to const_iterator
+    template< bool OtherIsConst, typename = std::enable_if_t<
+      IsConst && !OtherIsConst
+    > >
+    Iterator( const Iterator< OtherIsConst >& other )
+    : Iterator( other.log, other.pos ) {}
+
+    reference operator*() const { return log->GetEntry( pos ).event; }
+
+    pointer operator->() const { return &operator*(); }
 
-  // (FRONT) newest count -> oldest count ( BACK )
-  std::deque< size_t > epoch_counts{ 0 };
+    Iterator& operator++() { ++pos; return *this; }
+
+    Iterator operator++(int) { auto res = *this; ++pos; return res; }
+
+    Iterator& operator--() { --pos; return *this; }
+
+    Iterator operator--(int) { auto res = *this; --pos; return res; }
+
+    bool operator==( const Iterator& other ) const {
+      return log == other.log && pos == other.pos;
+    }
+
+    bool operator!=( const Iterator& other ) const {
+      return !operator==( other );
+    }
+
+  };
 
 public:
 
-  using const_iterator = typename decltype(events)::const_iterator;
-  using iterator = typename decltype(events)::iterator;
+  using const_iterator = Iterator< true >;
+  using iterator = Iterator< false >;
+
+  RunningLog() = default;
+
+  RunningLog( const RunningLog& other ) : epoch( other.epoch ) {
+    for ( size_t k = other.size; k--; ) {
+      const Entry& entry = other.GetEntry( k );
+      Emplace( entry.event, entry.epoch );
+    }
+  }
+
+  RunningLog( RunningLog&& other ) noexcept
+  : buffer( std::exchange( other.buffer, nullptr ) )
+  , capacity( std::exchange( other.capacity, 0 ) )
+  , head( std::exchange( other.head, 0 ) )
+  , size( std::exchange( other.size, 0 ) )
+  , epoch( other.epoch )
+  , summary( std::exchange( other.summary, {} ) )
+  {}
+
+  RunningLog& operator=( const RunningLog& other ) {
+    if ( this != &other ) *this = RunningLog( other );
+    return *this;
+  }
 
-  void Record( const Event& event ){
-    events.push_front( event );
-    ++epoch_counts.front();
+  RunningLog& operator=( RunningLog&& other ) noexcept {
+    if ( this != &other ) {
+      Clear();
+      buffer = std::exchange( other.buffer, nullptr );
+      capacity = std::exchange( other.capacity, 0 );
+      head = std::exchange( other.head, 0 );
+      size = std::exchange( other.size, 0 );
+      epoch = other.epoch;
+      summary = std::exchange( other.summary, {} );
+    }
+    return *this;
   }
 
+  ~RunningLog() { Clear(); }
+
+  void Record( const Event& event ) { Emplace( event, epoch ); }
+
   void Purge() {
 
+    ++epoch;
+
+    // retain events from the current epoch and the previous duration epochs
     const size_t duration = dish2::cfg.RUNNING_LOG_DURATION();
-    if ( epoch_counts.size() > duration ) {
-      emp_assert( epoch_counts.size() - duration == 1 );
-      events.resize( events.size() - epoch_counts.back() );
-      epoch_counts.resize( duration );
-    }
+    while (
+      size && static_cast<uint32_t>( epoch - GetOldest().epoch ) > duration
+    ) PopOldest();
 
-    epoch_counts.emplace_front();
+    if ( size == 0 ) Clear();
 
   }
 
-  size_t GetSize() const { return events.size(); }
+  size_t GetSize() const { return size; }
+
+  const summary_t& GetSummary() const { return summary; }
 
-  auto begin() { return std::begin( events ); }
-  auto begin() const { return std::begin( events ); }
-  auto cbegin() const { return std::cbegin( events ); }
+  auto begin() { return iterator{ this, 0 }; }
+  auto begin() const { return const_iterator{ this, 0 }; }
+  auto cbegin() const { return const_iterator{ this, 0 }; }
 
-  auto end() { return std::end( events ); }
-  auto end() const { return std::end( events ); }
-  auto cend() const { return std::cend( events ); }
+  auto end() { return iterator{ this, size }; }
+  auto end() const { return const_iterator{ this, size }; }
+  auto cend() const { return const_iterator{ this, size }; }
+
+  template <class Archive>
+  void save( Archive & ar ) const {
+    const uint64_t num_events = size;
+    ar( CEREAL_NVP( epoch ), CEREAL_NVP( num_events ) );
+    // oldest to newest, so load can replay records in order
+    for ( size_t k = size; k--; ) {
+      const Entry& entry = GetEntry( k );
+      ar( entry.epoch, entry.event );
+    }
+  }
+
+  template <class Archive>
+  void load( Archive & ar ) {
+    Clear();
+    uint64_t num_events;
+    ar( CEREAL_NVP( epoch ), CEREAL_NVP( num_events ) );
+    for ( uint64_t i{}; i < num_events; ++i ) {
+      uint32_t event_epoch;
+      Event event;
+      ar( event_epoch, event );
+      Emplace( std::move( event ), event_epoch );
+    }
+  }
 
 };
 
@@ -0,0 +1,85 @@
+#pragma once
+#ifndef DISH2_RUNNINGLOG_RUNNINGLOGARENA_HPP_INCLUDE
+#define DISH2_RUNNINGLOG_RUNNINGLOGARENA_HPP_INCLUDE
+
+#include <array>
+#include <cstddef>
+#include <new>
+
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+namespace dish2 {
+
+/// Per-thread cache of uninitialized ring buffer storage for running logs.
+/// Buffers have power-of-two capacities and are recycled through one free
+/// list per capacity, so steady-state event recording does not allocate.
+/// Each simulation thread owns one ThreadWorld, so this serves as that
+/// world's arena.
+/// Buffers may be released on a different thread than they were acquired on.
+template< typename Entry >
+class RunningLogArena {
+
+  // indexed by log2 capacity
+  std::array< emp::vector< Entry* >, 64 > free_lists;
+
+  // trivially destructible, so remains valid after the arena is destroyed
+  inline static thread_local bool destroyed{ false };
+
+  static Entry* Allocate( const size_t capacity ) {
+    return static_cast<Entry*>( ::operator new(
+      capacity * sizeof( Entry ), std::align_val_t{ alignof( Entry ) }
+    ) );
+  }
+
+  static void Deallocate( Entry* buffer ) {
+    ::operator delete( buffer, std::align_val_t{ alignof( Entry ) } );
+  }
+
+  static size_t GetSizeClass( const size_t capacity ) {
+    emp_assert( capacity && ( capacity & (capacity - 1) ) == 0, capacity );
+    return __builtin_ctzll( capacity );
+  }
+
+  RunningLogArena() = default;
+
+public:
+
+  ~RunningLogArena() {
+    for ( auto& free_list : free_lists ) {
+      for ( Entry* buffer : free_list ) Deallocate( buffer );
+    }
+    destroyed = true;
+  }
+
+  RunningLogArena( const RunningLogArena& ) = delete;
+  RunningLogArena& operator=( const RunningLogArena& ) = delete;
+
+  static RunningLogArena& Get() {
+    thread_local RunningLogArena arena;
+    return arena;
+  }
+
+  /// @param capacity number of entries, must be a power of two.
+  static Entry* Acquire( const size_t capacity ) {
+    if ( destroyed ) return Allocate( capacity );
+
+    auto& free_list = Get().free_lists[ GetSizeClass( capacity ) ];
+    if ( free_list.empty() ) return Allocate( capacity );
+
+    Entry* res = free_list.back();
+    free_list.pop_back();
+    return res;
+  }
+
+  /// @param capacity must match capacity buffer was acquired with.
+  static void Release( Entry* buffer, const size_t capacity ) {
+    if ( destroyed ) Deallocate( buffer );
+    else Get().free_lists[ GetSizeClass( capacity ) ].push_back( buffer );
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RUNNINGLOG_RUNNINGLOGARENA_HPP_INCLUDE
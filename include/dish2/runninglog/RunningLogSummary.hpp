@@ -0,0 +1,32 @@
+#pragma once
+#ifndef DISH2_RUNNINGLOG_RUNNINGLOGSUMMARY_HPP_INCLUDE
+#define DISH2_RUNNINGLOG_RUNNINGLOGSUMMARY_HPP_INCLUDE
+
+#include <cstddef>
+
+namespace dish2 {
+
+/// Aggregate statistics over the events in a running log, maintained as
+/// events are recorded and purged.
+/// Specialized for event types that support richer queries.
+template< typename Event >
+struct RunningLogSummary {
+
+  size_t num_events{};
+
+  void Add( const Event& ) { ++num_events; }
+
+  void Remove( const Event& ) { --num_events; }
+
+  RunningLogSummary& operator+=( const RunningLogSummary& other ) {
+    num_events += other.num_events;
+    return *this;
+  }
+
+  size_t GetSize() const { return num_events; }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RUNNINGLOG_RUNNINGLOGSUMMARY_HPP_INCLUDE
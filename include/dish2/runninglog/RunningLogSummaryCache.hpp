@@ -0,0 +1,70 @@
+#pragma once
+#ifndef DISH2_RUNNINGLOG_RUNNINGLOGSUMMARYCACHE_HPP_INCLUDE
+#define DISH2_RUNNINGLOG_RUNNINGLOGSUMMARYCACHE_HPP_INCLUDE
+
+#include <mutex>
+#include <tuple>
+
+#include "../../../third-party/Empirical/include/emp/base/optional.hpp"
+
+#include "BirthEvent.hpp"
+#include "DeathEventSummary.hpp"
+#include "RunningLogSummary.hpp"
+#include "SpawnEventSummary.hpp"
+
+namespace dish2 {
+
+/// Population-wide running log summaries, combined from per-cell summaries
+/// at most once between invalidations.
+/// Safe to query concurrently.
+template< typename Spec >
+class RunningLogSummaryCache {
+
+  template< typename Event >
+  using entry_t = emp::optional< dish2::RunningLogSummary< Event > >;
+
+  std::tuple<
+    entry_t< dish2::BirthEvent<Spec> >,
+    entry_t< dish2::DeathEvent<Spec> >,
+    entry_t< dish2::SpawnEvent<Spec> >
+  > entries;
+
+  std::mutex mutex;
+
+public:
+
+  RunningLogSummaryCache() = default;
+
+  // cached values are not carried over
+  RunningLogSummaryCache( const RunningLogSummaryCache& ) {}
+
+  RunningLogSummaryCache& operator=( const RunningLogSummaryCache& ) {
+    Invalidate();
+    return *this;
+  }
+
+  void Invalidate() {
+    const std::lock_guard guard( mutex );
+    entries = {};
+  }
+
+  template< typename Event, typename Population >
+  dish2::RunningLogSummary< Event > Get( const Population& population ) {
+    const std::lock_guard guard( mutex );
+
+    auto& entry = std::get< entry_t< Event > >( entries );
+    if ( !entry.has_value() ) {
+      entry.emplace();
+      for ( const auto& cell : population ) {
+        *entry += cell.running_logs.template GetLog< Event >().GetSummary();
+      }
+    }
+
+    return *entry;
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RUNNINGLOG_RUNNINGLOGSUMMARYCACHE_HPP_INCLUDE
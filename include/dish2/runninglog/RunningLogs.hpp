@@ -5,10 +5,16 @@
 #include <tuple>
 #include <utility>
 
+#include "../../../third-party/cereal/include/cereal/cereal.hpp"
+#include "../../../third-party/cereal/include/cereal/types/tuple.hpp"
+
 #include "BirthEvent.hpp"
 #include "DeathEvent.hpp"
+#include "DeathEventSummary.hpp"
+#include "EventStream.hpp"
 #include "RunningLog.hpp"
 #include "SpawnEvent.hpp"
+#include "SpawnEventSummary.hpp"
 
 namespace dish2 {
 
@@ -26,6 +32,7 @@ public:
   template<typename Event>
   void Record( const Event& event ) {
     std::get<dish2::RunningLog<Event>>( logs ).Record( event );
+    dish2::EventStream<Spec>::Get().Record( event );
   }
 
   void Purge() {
@@ -39,6 +46,9 @@ public:
     return std::get<dish2::RunningLog<Event>>( logs );
   }
 
+  template <class Archive>
+  void serialize( Archive & ar ) { ar( CEREAL_NVP( logs ) ); }
+
 };
 
 } // namespace dish2
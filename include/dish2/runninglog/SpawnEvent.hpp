@@ -2,6 +2,8 @@
 #ifndef DISH2_RUNNINGLOG_SPAWNEVENT_HPP_INCLUDE
 #define DISH2_RUNNINGLOG_SPAWNEVENT_HPP_INCLUDE
 
+#include "../../../third-party/cereal/include/cereal/cereal.hpp"
+#include "../../../third-party/cereal/include/cereal/types/array.hpp"
 #include "../../../third-party/Empirical/include/emp/base/array.hpp"
 
 namespace dish2 {
@@ -16,6 +18,16 @@ struct SpawnEvent {
   emp::array<size_t, Spec::NLEV> peripherality_parent;
   size_t replev;
 
+  template <class Archive>
+  void serialize( Archive & ar ) { ar(
+    CEREAL_NVP( kin_id_commonality_daughter_eliminated ),
+    CEREAL_NVP( kin_id_commonality_parent_daughter ),
+    CEREAL_NVP( kin_id_commonality_parent_eliminated ),
+    CEREAL_NVP( num_neighbors_parent ),
+    CEREAL_NVP( peripherality_parent ),
+    CEREAL_NVP( replev )
+  ); }
+
 };
 
 } // namespace dish2
@@ -0,0 +1,129 @@
+#pragma once
+#ifndef DISH2_RUNNINGLOG_SPAWNEVENTSUMMARY_HPP_INCLUDE
+#define DISH2_RUNNINGLOG_SPAWNEVENTSUMMARY_HPP_INCLUDE
+
+#include <cstddef>
+
+#include "../../../third-party/Empirical/include/emp/base/array.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+
+#include "RunningLogSummary.hpp"
+#include "SpawnEvent.hpp"
+
+namespace dish2 {
+
+/// Tallies spawn events, neighbor counts, and kin counts, each broken down
+/// by replev.
+template< typename Spec >
+struct RunningLogSummary< dish2::SpawnEvent<Spec> > {
+
+  using event_t = dish2::SpawnEvent<Spec>;
+
+  constexpr static size_t NLEV = Spec::NLEV;
+
+  // replev and kin id commonality both range over [0, NLEV]
+  template< typename T >
+  using by_replev_t = emp::array< T, NLEV + 1 >;
+  template< typename T >
+  using by_lev_t = emp::array< T, NLEV >;
+  template< typename T >
+  using by_commonality_t = emp::array< T, NLEV + 1 >;
+
+  by_replev_t< size_t > num_events{};
+  by_replev_t< size_t > num_neighbors{};
+  by_lev_t< by_replev_t< size_t > > num_kin_neighbors{};
+  // by kin id commonality between parent and eliminated cell
+  by_commonality_t< by_replev_t< size_t > > num_eliminated{};
+
+  template< typename Op >
+  void Apply( const event_t& event, Op op ) {
+    const size_t replev = event.replev;
+    const size_t commonality = event.kin_id_commonality_parent_eliminated;
+    emp_assert( replev <= NLEV, replev );
+    emp_assert( commonality <= NLEV, commonality );
+
+    op( num_events[replev], 1 );
+    op( num_neighbors[replev], event.num_neighbors_parent );
+    for ( size_t lev{}; lev < NLEV; ++lev ) {
+      const size_t peripherality = event.peripherality_parent[lev];
+      emp_assert( event.num_neighbors_parent >= peripherality );
+      op(
+        num_kin_neighbors[lev][replev],
+        event.num_neighbors_parent - peripherality
+      );
+    }
+    op( num_eliminated[commonality][replev], 1 );
+  }
+
+  template< typename T >
+  static size_t Sum( const by_replev_t< T >& by_replev ) {
+    size_t res{};
+    for ( const auto val : by_replev ) res += val;
+    return res;
+  }
+
+  void Add( const event_t& event ) {
+    Apply( event, []( size_t& val, const size_t n ){ val += n; } );
+  }
+
+  void Remove( const event_t& event ) {
+    Apply( event, []( size_t& val, const size_t n ){ val -= n; } );
+  }
+
+  RunningLogSummary& operator+=( const RunningLogSummary& other ) {
+    for ( size_t replev{}; replev <= NLEV; ++replev ) {
+      num_events[replev] += other.num_events[replev];
+      num_neighbors[replev] += other.num_neighbors[replev];
+      for ( size_t lev{}; lev < NLEV; ++lev ) {
+        num_kin_neighbors[lev][replev] += other.num_kin_neighbors[lev][replev];
+      }
+      for ( size_t common{}; common <= NLEV; ++common ) {
+        num_eliminated[common][replev] += other.num_eliminated[common][replev];
+      }
+    }
+    return *this;
+  }
+
+  size_t GetSize() const { return Sum( num_events ); }
+
+  size_t GetSize( const size_t replev ) const { return num_events[replev]; }
+
+  size_t GetNumNeighbors() const { return Sum( num_neighbors ); }
+
+  size_t GetNumNeighbors( const size_t replev ) const {
+    return num_neighbors[replev];
+  }
+
+  size_t GetNumKinNeighbors( const size_t lev ) const {
+    return Sum( num_kin_neighbors[lev] );
+  }
+
+  size_t GetNumKinNeighbors( const size_t lev, const size_t replev ) const {
+    return num_kin_neighbors[lev][replev];
+  }
+
+  /// Count events where parent and eliminated cell have at least
+  /// min_commonality kin id commonality.
+  size_t GetNumKinEliminated( const size_t min_commonality ) const {
+    size_t res{};
+    for ( size_t common = min_commonality; common <= NLEV; ++common ) {
+      res += Sum( num_eliminated[common] );
+    }
+    return res;
+  }
+
+  size_t GetNumKinEliminated(
+    const size_t min_commonality, const size_t replev
+  ) const {
+    size_t res{};
+    for ( size_t common = min_commonality; common <= NLEV; ++common ) {
+      res += num_eliminated[common][replev];
+    }
+    return res;
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_RUNNINGLOG_SPAWNEVENTSUMMARY_HPP_INCLUDE
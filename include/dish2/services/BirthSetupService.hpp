@@ -14,6 +14,7 @@
 #include "../config/cfg.hpp"
 #include "../debug/LogScope.hpp"
 #include "../peripheral/readable_state/ReadableState.hpp"
+#include "../phylogeny/PhylogenyTracker.hpp"
 #include "../runninglog/BirthEvent.hpp"
 
 namespace dish2 {
@@ -87,7 +88,14 @@ struct BirthSetupService {
       // setup new genome
       cell.DeathRoutine( dish2::CauseOfDeath::elimination );
       cell.genome = incoming_genome;
+      const size_t prev_num_mutations
+        = cell.genome->mutation_counter.mutation_occurrence_counter;
       cell.genome->ElapseGeneration( replev, epoch );
+      cell.genome->taxon_id = dish2::PhylogenyTracker::Get().RecordBirth(
+        cell.genome->taxon_id,
+        cell.genome->mutation_counter.mutation_occurrence_counter
+          != prev_num_mutations
+      );
 
       cell.MakeAliveRoutine();
     }
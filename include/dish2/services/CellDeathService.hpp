@@ -12,6 +12,7 @@
 #include "../cell/cardinal_iterators/NeighborIsAliveWrapper.hpp"
 #include "../config/cfg.hpp"
 #include "../debug/LogScope.hpp"
+#include "../debug/tally_put.hpp"
 #include "../enum/CauseOfDeath.hpp"
 
 namespace dish2 {
@@ -29,7 +30,8 @@ class CellDeathService {
       cell.template end<dish2::NeighborIsAliveWrapper<spec_t>>(),
       std::identity
     ) ) {
-      cell.template begin<dish2::GenomeNodeOutputWrapper<spec_t>>()->TryPut(
+      dish2::tally_put(
+        *cell.template begin<dish2::GenomeNodeOutputWrapper<spec_t>>(),
         *cell.genome
       );
     }
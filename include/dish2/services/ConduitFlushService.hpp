@@ -2,21 +2,56 @@
 #ifndef DISH2_SERVICES_CONDUITFLUSHSERVICE_HPP_INCLUDE
 #define DISH2_SERVICES_CONDUITFLUSHSERVICE_HPP_INCLUDE
 
+#include <algorithm>
+#include <cstdint>
+
+#include <mpi.h>
+
 #include "../../../third-party/conduit/include/uitsl/math/shift_mod.hpp"
+#include "../../../third-party/conduit/include/uitsl/mpi/comm_utils.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
 
 #include "../config/cfg.hpp"
 #include "../debug/LogScope.hpp"
+#include "../debug/MeshPutTally.hpp"
+#include "../parallel/GlobalAllreduce.hpp"
 
 namespace dish2 {
 
+/// Flushes one mesh's outputs, selected by `Target`, on that mesh's schedule.
+/// Schedules depend only on the update, so they agree across threads and
+/// processes.
+/// If `CONDUIT_FLUSH_ONLY_DIRTY` is set, scheduled flushes are skipped when
+/// no puts have been made to the mesh on any thread of any process since the
+/// last flush, as decided by `dish2::decide_conduit_flushes` before the
+/// update's cells are serviced.
+template< typename Spec, typename Target >
 struct ConduitFlushService {
 
+  using tally_t = dish2::MeshPutTally< typename Target::template mesh_spec_t<
+    Spec
+  > >;
+
+  static size_t GetFrequency() {
+    const size_t freq = Target::GetFrequency();
+    return freq ? freq : dish2::cfg.CONDUIT_FLUSH_SERVICE_FREQUENCY();
+  }
+
+  static bool IsScheduled( const size_t update ) {
+    const size_t freq = GetFrequency();
+    return freq && !uitsl::shift_mod( update, freq );
+  }
+
+  /// Whether mesh was dirty at this update's decision.
+  static bool& GetDirtyDecision() {
+    thread_local bool decision{ true };
+    return decision;
+  }
+
   static bool ShouldRun( const size_t update, const bool alive ) {
-    const size_t freq = dish2::cfg.CONDUIT_FLUSH_SERVICE_FREQUENCY();
     // must run whether cell is alive or not to keep aggregated flushes in sync
-    return
-      freq > 0
-      && uitsl::shift_mod( update, freq ) == 0;
+    if ( !IsScheduled( update ) ) return false;
+    else return !dish2::cfg.CONDUIT_FLUSH_ONLY_DIRTY() || GetDirtyDecision();
   }
 
   template<typename Cell>
@@ -25,17 +60,156 @@ struct ConduitFlushService {
     const dish2::LogScope guard{ "conduit flush service", "TODO", 3 };
 
     for (auto& cardinal : cell.cardinals) {
-      cardinal.genome_node_output.TryFlush();
-      cardinal.message_node_output.TryFlush();
-      cardinal.cardinal_quorum_state.output.TryFlush();
-      cardinal.resource_node_output.TryFlush();
-      cardinal.state_node_output.TryFlush();
+      Target::GetOutput( cardinal ).TryFlush();
     }
 
   }
 
 };
 
+namespace internal_conduit_flush {
+
+struct GenomeTarget {
+  template<typename Spec> using mesh_spec_t = typename Spec::genome_mesh_spec_t;
+  static size_t GetFrequency() {
+    return dish2::cfg.GENOME_CONDUIT_FLUSH_FREQUENCY();
+  }
+  template<typename Cardinal>
+  static auto& GetOutput( Cardinal& cardinal ) {
+    return cardinal.genome_node_output;
+  }
+};
+
+struct MessageTarget {
+  template<typename Spec>
+  using mesh_spec_t = typename Spec::message_mesh_spec_t;
+  static size_t GetFrequency() {
+    return dish2::cfg.MESSAGE_CONDUIT_FLUSH_FREQUENCY();
+  }
+  template<typename Cardinal>
+  static auto& GetOutput( Cardinal& cardinal ) {
+    return cardinal.message_node_output;
+  }
+};
+
+struct QuorumTarget {
+  template<typename Spec> using mesh_spec_t = typename Spec::quorum_mesh_spec_t;
+  static size_t GetFrequency() {
+    return dish2::cfg.QUORUM_CONDUIT_FLUSH_FREQUENCY();
+  }
+  template<typename Cardinal>
+  static auto& GetOutput( Cardinal& cardinal ) {
+    return cardinal.cardinal_quorum_state.output;
+  }
+};
+
+struct ResourceTarget {
+  template<typename Spec>
+  using mesh_spec_t = typename Spec::resource_mesh_spec_t;
+  static size_t GetFrequency() {
+    return dish2::cfg.RESOURCE_CONDUIT_FLUSH_FREQUENCY();
+  }
+  template<typename Cardinal>
+  static auto& GetOutput( Cardinal& cardinal ) {
+    return cardinal.resource_node_output;
+  }
+};
+
+struct StateTarget {
+  template<typename Spec> using mesh_spec_t = typename Spec::state_mesh_spec_t;
+  static size_t GetFrequency() {
+    return dish2::cfg.STATE_CONDUIT_FLUSH_FREQUENCY();
+  }
+  template<typename Cardinal>
+  static auto& GetOutput( Cardinal& cardinal ) {
+    return cardinal.state_node_output;
+  }
+};
+
+} // namespace internal_conduit_flush
+
+template<typename Spec>
+using GenomeConduitFlushService = dish2::ConduitFlushService<
+  Spec, internal_conduit_flush::GenomeTarget
+>;
+
+template<typename Spec>
+using MessageConduitFlushService = dish2::ConduitFlushService<
+  Spec, internal_conduit_flush::MessageTarget
+>;
+
+template<typename Spec>
+using QuorumConduitFlushService = dish2::ConduitFlushService<
+  Spec, internal_conduit_flush::QuorumTarget
+>;
+
+template<typename Spec>
+using ResourceConduitFlushService = dish2::ConduitFlushService<
+  Spec, internal_conduit_flush::ResourceTarget
+>;
+
+template<typename Spec>
+using StateConduitFlushService = dish2::ConduitFlushService<
+  Spec, internal_conduit_flush::StateTarget
+>;
+
+namespace internal_conduit_flush {
+
+template< typename... Services >
+void decide_flushes( const size_t update ) {
+
+  if (
+    !dish2::cfg.CONDUIT_FLUSH_ONLY_DIRTY()
+    || !( Services::IsScheduled( update ) || ... )
+  ) return;
+
+  // reduction is collective, so all threads and processes must step through
+  // the same updates in lockstep
+  emp_always_assert(
+    ( !dish2::cfg.RUN_SECONDS() && !dish2::cfg.ASYNCHRONOUS() )
+      || ( !uitsl::is_multiprocess() && dish2::cfg.N_THREADS() == 1 ),
+    "CONDUIT_FLUSH_ONLY_DIRTY with multiple threads or processes "
+    "requires RUN_SECONDS 0 and ASYNCHRONOUS 0"
+  );
+
+  // any thread of any process with puts requires every thread to flush
+  static dish2::GlobalAllreduce< uint8_t > reduce(
+    MPI_UINT8_T, MPI_MAX,
+    []( const uint8_t a, const uint8_t b ){ return std::max( a, b ); }
+  );
+
+  // unscheduled meshes keep their dirty flags until their next flush
+  const auto dirty = reduce( { uint8_t(
+    Services::IsScheduled( update )
+      && Services::tally_t::Get().TakeDirty()
+  )... } );
+
+  size_t i{};
+  ( ( Services::GetDirtyDecision() = dirty[ i++ ] ), ... );
+
+}
+
+} // namespace internal_conduit_flush
+
+/// Decide which scheduled flushes this update may skip under
+/// `CONDUIT_FLUSH_ONLY_DIRTY`, with one reduction of all meshes' dirty
+/// flags across threads and processes.
+/// Call once per update before servicing cells, so that outputs sharing an
+/// aggregated back end agree.
+/// Puts made during an update are counted at the next decision, so puts
+/// made during the update of a skipped flush wait up to one more flush
+/// period.
+template< typename Spec >
+void decide_conduit_flushes( const size_t update ) {
+  internal_conduit_flush::decide_flushes<
+    dish2::GenomeConduitFlushService< Spec >,
+    dish2::MessageConduitFlushService< Spec >,
+    dish2::QuorumConduitFlushService< Spec >,
+    dish2::ResourceConduitFlushService< Spec >,
+    dish2::StateConduitFlushService< Spec >
+  >( update );
+}
+
 } // namespace dish2
 
 #endif // #ifndef DISH2_SERVICES_CONDUITFLUSHSERVICE_HPP_INCLUDE
@@ -23,6 +23,7 @@
 #include "../cell/cardinal_iterators/ResourceStockpileWrapper.hpp"
 #include "../config/cfg.hpp"
 #include "../debug/LogScope.hpp"
+#include "../debug/tally_put.hpp"
 
 namespace dish2 {
 
@@ -254,7 +255,7 @@ struct ResourceSendingService {
       [&stockpile](const float send_amount, auto& resource_output){
         stockpile -= send_amount;
         uitsl_err_audit(!
-          resource_output.TryPut( send_amount )
+          dish2::tally_put( resource_output, send_amount )
         );
       }
     );
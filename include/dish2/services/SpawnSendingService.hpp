@@ -19,6 +19,9 @@
 #include "../cell/cardinal_iterators/SpawnRequestWrapper.hpp"
 #include "../config/cfg.hpp"
 #include "../debug/LogScope.hpp"
+#include "../debug/MeshPutTally.hpp"
+#include "../genome/WireGenome.hpp"
+#include "../phylogeny/PhylogenyTracker.hpp"
 #include "../runninglog/SpawnEvent.hpp"
 
 namespace dish2 {
@@ -76,6 +79,10 @@ struct SpawnSendingService {
       []( const auto arrest, const auto request ){ return request && !arrest; }
     );
 
+    // convert once for all puts, reusing storage across calls
+    thread_local dish2::WireGenome< spec_t > wire_genome;
+    if ( requested_outputs.size() ) wire_genome = *cell.genome;
+
     while ( available_resource >= 1 && requested_outputs.size() ) {
 
       // pick a random request
@@ -84,7 +91,10 @@ struct SpawnSendingService {
       );
 
       // do the spawn send
-      requested_outputs[ idx ].get().Put( *cell.genome );
+      requested_outputs[ idx ].get().Put( wire_genome );
+      dish2::MeshPutTally< typename spec_t::genome_mesh_spec_t >::Get()
+        .MarkDirty();
+      dish2::PhylogenyTracker::Get().RecordSpawn( cell.genome->taxon_id );
       available_resource -= 1;
 
       // record spawn send in spawn count
@@ -12,6 +12,7 @@
 #include "../cell/cardinal_iterators/StateNodeOutputWrapper.hpp"
 #include "../config/cfg.hpp"
 #include "../debug/LogScope.hpp"
+#include "../debug/tally_put.hpp"
 
 namespace dish2 {
 
@@ -36,7 +37,7 @@ struct StateOutputPutService {
       cell.template end<dish2::StateNodeOutputWrapper<spec_t>>(),
       cell.template begin<dish2::ReadableStateWrapper<spec_t>>(),
       []( auto& output, const auto& readable_state ){
-        output.TryPut( readable_state );
+        dish2::tally_put( output, readable_state );
       }
     );
 
@@ -10,7 +10,7 @@
 #include "../../../third-party/conduit/include/uit/setup/ImplSpec.hpp"
 #include "../../../third-party/conduit/include/uit/spouts/wrappers/CachingSpoutWrapper.hpp"
 
-#include "../genome/Genome.hpp"
+#include "../genome/WireGenome.hpp"
 
 namespace dish2 {
 
@@ -33,7 +33,7 @@ namespace internal_genome_spec {
 
   template<typename Spec>
   using ImplSpec = uit::ImplSpec<
-    dish2::Genome<Spec>,
+    dish2::WireGenome<Spec>,
     ImplSel,
     uit::CachingSpoutWrapper,
     2, // N
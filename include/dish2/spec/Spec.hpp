@@ -97,7 +97,11 @@ struct Spec {
     dish2::BirthSetupService,
     dish2::CellAgeService,
     dish2::CollectiveHarvestingService,
-    dish2::ConduitFlushService,
+    dish2::GenomeConduitFlushService< this_t >,
+    dish2::MessageConduitFlushService< this_t >,
+    dish2::QuorumConduitFlushService< this_t >,
+    dish2::ResourceConduitFlushService< this_t >,
+    dish2::StateConduitFlushService< this_t >,
     dish2::EventLaunchingService,
     dish2::InterMessageLaunchingService,
     dish2::InterMessagePurgingService,
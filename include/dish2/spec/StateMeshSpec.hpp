@@ -9,6 +9,7 @@
 #include "../../../third-party/conduit/include/uit/setup/ImplSelect.hpp"
 #include "../../../third-party/conduit/include/uit/setup/ImplSpec.hpp"
 
+#include "../parallel/SharedWindowDuctAdapter.hpp"
 #include "../peripheral/readable_state/ReadableState.hpp"
 
 namespace dish2 {
@@ -24,7 +25,7 @@ using ImplSel = uit::ImplSelect<
   #endif
   ,
   #ifndef __EMSCRIPTEN__
-    uit::t::PooledIriObiDuct
+    dish2::SharedWindowDuctAdapter< uit::t::PooledIriObiDuct >::Duct
   #else
     uit::EmpAssertDuct
   #endif
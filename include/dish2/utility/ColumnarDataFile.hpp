@@ -0,0 +1,224 @@
+#pragma once
+#ifndef DISH2_UTILITY_COLUMNARDATAFILE_HPP_INCLUDE
+#define DISH2_UTILITY_COLUMNARDATAFILE_HPP_INCLUDE
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+#include <zlib.h>
+
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+#include "../../../third-party/Empirical/include/emp/tools/string_utils.hpp"
+
+namespace dish2 {
+
+namespace internal_columnar {
+
+  constexpr char magic[8] = "DISH2CF";
+  constexpr uint32_t version = 1;
+
+  enum class ColumnType : uint8_t { Double, UInt, String };
+
+  template< typename T >
+  void write_raw( std::ostream& os, const T& val ) {
+    os.write( reinterpret_cast<const char*>( &val ), sizeof( val ) );
+  }
+
+  void write_string( std::ostream& os, const std::string& str ) {
+    write_raw< uint64_t >( os, str.size() );
+    os.write( str.data(), str.size() );
+  }
+
+  // writes raw size, stored size, then stored bytes
+  void write_block(
+    std::ostream& os, const char* data, const size_t num_bytes, const int level
+  ) {
+    write_raw< uint64_t >( os, num_bytes );
+
+    if ( level == 0 ) {
+      write_raw< uint64_t >( os, num_bytes );
+      os.write( data, num_bytes );
+      return;
+    }
+
+    thread_local std::string compressed;
+    uLongf compressed_size = compressBound( num_bytes );
+    compressed.resize( compressed_size );
+    emp_always_assert( compress2(
+      reinterpret_cast<Bytef*>( compressed.data() ), &compressed_size,
+      reinterpret_cast<const Bytef*>( data ), num_bytes,
+      level
+    ) == Z_OK );
+
+    write_raw< uint64_t >( os, compressed_size );
+    os.write( compressed.data(), compressed_size );
+  }
+
+} // namespace internal_columnar
+
+/// Drop-in alternative to `emp::DataFile` for long-format data that writes a
+/// fixed-schema columnar binary file.
+/// String columns are dictionary encoded, so repeated metric names are stored
+/// once.
+/// Rows are buffered and flushed in row groups, with each column of a row
+/// group deflate-compressed separately.
+/// Layout: magic, version, compression flag, constants (name, value),
+/// columns (type, name), then row groups until end of file.
+/// Each row group is a row count, new dictionary entries for each string
+/// column, and one block per column.
+class ColumnarDataFile {
+
+  using ColumnType = internal_columnar::ColumnType;
+
+  struct Column {
+    std::string name;
+    ColumnType type;
+    std::function< void() > sample;
+    emp::vector< char > buffer;
+    // string columns only
+    std::unordered_map< std::string, uint32_t > dictionary;
+    emp::vector< std::string > new_entries;
+  };
+
+  std::ofstream os;
+  size_t row_group_size;
+  int level;
+
+  emp::vector< std::pair< std::string, std::string > > constants;
+  emp::vector< Column > columns;
+  size_t num_buffered_rows{};
+  bool header_written{ false };
+
+  template< typename T >
+  static void Append( emp::vector< char >& buffer, const T& val ) {
+    const char* bytes = reinterpret_cast<const char*>( &val );
+    buffer.insert( std::end( buffer ), bytes, bytes + sizeof( val ) );
+  }
+
+  void WriteHeader() {
+    os.write( internal_columnar::magic, sizeof( internal_columnar::magic ) );
+    internal_columnar::write_raw( os, internal_columnar::version );
+    internal_columnar::write_raw< uint32_t >( os, level > 0 );
+
+    internal_columnar::write_raw< uint64_t >( os, constants.size() );
+    for ( const auto& [name, value] : constants ) {
+      internal_columnar::write_string( os, name );
+      internal_columnar::write_string( os, value );
+    }
+
+    internal_columnar::write_raw< uint64_t >( os, columns.size() );
+    for ( const auto& column : columns ) {
+      internal_columnar::write_raw( os, column.type );
+      internal_columnar::write_string( os, column.name );
+    }
+
+    header_written = true;
+  }
+
+public:
+
+  /// @param level deflate level for column blocks, or 0 for uncompressed.
+  ColumnarDataFile(
+    const std::string& path,
+    const size_t row_group_size_=65536,
+    const int level_=6
+  ) : os( path, std::ios::binary )
+  , row_group_size( row_group_size_ )
+  , level( level_ ) {
+    emp_always_assert( os, path );
+    emp_always_assert( row_group_size );
+  }
+
+  ~ColumnarDataFile() { Flush(); }
+
+  ColumnarDataFile( const ColumnarDataFile& ) = delete;
+  ColumnarDataFile& operator=( const ColumnarDataFile& ) = delete;
+
+  /// Record a value that is constant across the entire file.
+  template< typename T >
+  void AddVal( const T& val, const std::string& name ) {
+    emp_assert( !header_written );
+    constants.emplace_back( name, emp::to_string( val ) );
+  }
+
+  void AddVar( const double& var, const std::string& name ) {
+    emp_assert( !header_written );
+    auto& column = columns.emplace_back();
+    column.name = name;
+    column.type = ColumnType::Double;
+    column.sample = [this, &var, idx = columns.size() - 1](){
+      Append( columns[idx].buffer, var );
+    };
+  }
+
+  void AddVar( const size_t& var, const std::string& name ) {
+    emp_assert( !header_written );
+    auto& column = columns.emplace_back();
+    column.name = name;
+    column.type = ColumnType::UInt;
+    column.sample = [this, &var, idx = columns.size() - 1](){
+      Append< uint64_t >( columns[idx].buffer, var );
+    };
+  }
+
+  void AddVar( const std::string& var, const std::string& name ) {
+    emp_assert( !header_written );
+    auto& column = columns.emplace_back();
+    column.name = name;
+    column.type = ColumnType::String;
+    column.sample = [this, &var, idx = columns.size() - 1](){
+      auto& column = columns[idx];
+      const auto [it, inserted] = column.dictionary.try_emplace(
+        var, column.dictionary.size()
+      );
+      if ( inserted ) column.new_entries.push_back( var );
+      Append< uint32_t >( column.buffer, it->second );
+    };
+  }
+
+  /// Finalize the schema. Named to match `emp::DataFile`.
+  void PrintHeaderKeys() { WriteHeader(); }
+
+  /// Record a row from the current values of all variables.
+  void Update() {
+    emp_assert( header_written );
+    for ( auto& column : columns ) column.sample();
+    if ( ++num_buffered_rows == row_group_size ) Flush();
+  }
+
+  /// Write buffered rows as a row group.
+  void Flush() {
+    if ( num_buffered_rows == 0 ) return;
+
+    internal_columnar::write_raw< uint64_t >( os, num_buffered_rows );
+
+    for ( auto& column : columns ) {
+      if ( column.type != ColumnType::String ) continue;
+      const uint64_t num_new_entries = column.new_entries.size();
+      internal_columnar::write_raw( os, num_new_entries );
+      for ( const auto& entry : column.new_entries ) {
+        internal_columnar::write_string( os, entry );
+      }
+      column.new_entries.clear();
+    }
+
+    for ( auto& column : columns ) {
+      internal_columnar::write_block(
+        os, column.buffer.data(), column.buffer.size(), level
+      );
+      column.buffer.clear();
+    }
+
+    num_buffered_rows = 0;
+    os.flush();
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_UTILITY_COLUMNARDATAFILE_HPP_INCLUDE
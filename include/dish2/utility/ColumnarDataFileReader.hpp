@@ -0,0 +1,181 @@
+#pragma once
+#ifndef DISH2_UTILITY_COLUMNARDATAFILEREADER_HPP_INCLUDE
+#define DISH2_UTILITY_COLUMNARDATAFILEREADER_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+
+#include <zlib.h>
+
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "ColumnarDataFile.hpp"
+
+namespace dish2 {
+
+namespace internal_columnar {
+
+  template< typename T >
+  T read_raw( std::istream& is ) {
+    T res;
+    is.read( reinterpret_cast<char*>( &res ), sizeof( res ) );
+    emp_always_assert( is );
+    return res;
+  }
+
+  std::string read_string( std::istream& is ) {
+    std::string res( read_raw< uint64_t >( is ), '\0' );
+    is.read( res.data(), res.size() );
+    emp_always_assert( is );
+    return res;
+  }
+
+  std::string read_block( std::istream& is, const bool compressed ) {
+    const auto raw_size = read_raw< uint64_t >( is );
+    const auto stored_size = read_raw< uint64_t >( is );
+
+    std::string stored( stored_size, '\0' );
+    is.read( stored.data(), stored_size );
+    emp_always_assert( is );
+
+    if ( !compressed ) return stored;
+
+    std::string raw( raw_size, '\0' );
+    uLongf decompressed_size = raw_size;
+    emp_always_assert( uncompress(
+      reinterpret_cast<Bytef*>( raw.data() ), &decompressed_size,
+      reinterpret_cast<const Bytef*>( stored.data() ), stored_size
+    ) == Z_OK );
+    emp_always_assert( decompressed_size == raw_size );
+    return raw;
+  }
+
+} // namespace internal_columnar
+
+/// Reads a file written by `dish2::ColumnarDataFile` fully into memory.
+class ColumnarDataFileReader {
+
+  using ColumnType = internal_columnar::ColumnType;
+
+  std::unordered_map< std::string, std::string > constants;
+  emp::vector< std::string > names;
+  emp::vector< ColumnType > types;
+  // numeric columns keep raw bytes, string columns keep decoded values
+  emp::vector< std::string > numeric_data;
+  emp::vector< emp::vector< std::string > > string_data;
+  size_t num_rows{};
+
+  size_t FindColumn( const std::string& name, const ColumnType type ) const {
+    const auto it = std::find( std::begin( names ), std::end( names ), name );
+    emp_always_assert( it != std::end( names ), name );
+    const size_t idx = std::distance( std::begin( names ), it );
+    emp_always_assert( types[idx] == type, name );
+    return idx;
+  }
+
+  template< typename T >
+  emp::vector< T > GetNumericColumn( const size_t idx ) const {
+    const auto& bytes = numeric_data[idx];
+    emp::vector< T > res( bytes.size() / sizeof( T ) );
+    std::memcpy( res.data(), bytes.data(), bytes.size() );
+    return res;
+  }
+
+public:
+
+  explicit ColumnarDataFileReader( const std::string& path ) {
+
+    std::ifstream is( path, std::ios::binary );
+    emp_always_assert( is, path );
+
+    char magic[ sizeof( internal_columnar::magic ) ];
+    is.read( magic, sizeof( magic ) );
+    emp_always_assert(
+      std::memcmp( magic, internal_columnar::magic, sizeof( magic ) ) == 0,
+      path
+    );
+    emp_always_assert(
+      internal_columnar::read_raw< uint32_t >( is )
+        == internal_columnar::version,
+      path
+    );
+    const bool compressed = internal_columnar::read_raw< uint32_t >( is );
+
+    const auto num_constants = internal_columnar::read_raw< uint64_t >( is );
+    for ( size_t i{}; i < num_constants; ++i ) {
+      auto name = internal_columnar::read_string( is );
+      constants[ name ] = internal_columnar::read_string( is );
+    }
+
+    const auto num_columns = internal_columnar::read_raw< uint64_t >( is );
+    for ( size_t i{}; i < num_columns; ++i ) {
+      types.push_back( internal_columnar::read_raw< ColumnType >( is ) );
+      names.push_back( internal_columnar::read_string( is ) );
+    }
+    numeric_data.resize( num_columns );
+    string_data.resize( num_columns );
+
+    emp::vector< emp::vector< std::string > > dictionaries( num_columns );
+
+    // read row groups until end of file
+    while ( is.peek() != std::ifstream::traits_type::eof() ) {
+
+      num_rows += internal_columnar::read_raw< uint64_t >( is );
+
+      for ( size_t col{}; col < num_columns; ++col ) {
+        if ( types[col] != ColumnType::String ) continue;
+        const auto num_new = internal_columnar::read_raw< uint64_t >( is );
+        for ( size_t i{}; i < num_new; ++i ) {
+          dictionaries[col].push_back( internal_columnar::read_string( is ) );
+        }
+      }
+
+      for ( size_t col{}; col < num_columns; ++col ) {
+        const std::string block = internal_columnar::read_block(
+          is, compressed
+        );
+        if ( types[col] == ColumnType::String ) {
+          for ( size_t pos{}; pos < block.size(); pos += sizeof( uint32_t ) ) {
+            uint32_t code;
+            std::memcpy( &code, block.data() + pos, sizeof( code ) );
+            string_data[col].push_back( dictionaries[col].at( code ) );
+          }
+        } else numeric_data[col] += block;
+      }
+
+    }
+
+  }
+
+  size_t GetNumRows() const { return num_rows; }
+
+  const emp::vector< std::string >& GetColumnNames() const { return names; }
+
+  const std::string& GetConstant( const std::string& name ) const {
+    return constants.at( name );
+  }
+
+  emp::vector< double > GetDoubleColumn( const std::string& name ) const {
+    return GetNumericColumn< double >( FindColumn( name, ColumnType::Double ) );
+  }
+
+  emp::vector< uint64_t > GetUIntColumn( const std::string& name ) const {
+    return GetNumericColumn< uint64_t >( FindColumn( name, ColumnType::UInt ) );
+  }
+
+  const emp::vector< std::string >& GetStringColumn(
+    const std::string& name
+  ) const {
+    return string_data[ FindColumn( name, ColumnType::String ) ];
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_UTILITY_COLUMNARDATAFILEREADER_HPP_INCLUDE
@@ -0,0 +1,108 @@
+#pragma once
+#ifndef DISH2_UTILITY_DEFLATEDSIZECOUNTER_HPP_INCLUDE
+#define DISH2_UTILITY_DEFLATEDSIZECOUNTER_HPP_INCLUDE
+
+#include <cstddef>
+#include <streambuf>
+
+#include <zlib.h>
+
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/array.hpp"
+
+namespace dish2 {
+
+/// Stream buffer that gzip-deflates everything written to it and counts
+/// input and output bytes, discarding compressed output.
+/// Measures compressed size without writing to disk or holding the
+/// compressed data in memory.
+class DeflatedSizeCounter : public std::streambuf {
+
+  z_stream stream{};
+  // compressed output is written here and discarded
+  emp::array< Bytef, 16384 > sink;
+  size_t num_raw_bytes{};
+  size_t num_deflated_bytes{};
+  bool finished{};
+
+  void Deflate( const char* data, const size_t size, const int flush ) {
+    stream.next_in = reinterpret_cast<Bytef*>( const_cast<char*>( data ) );
+    stream.avail_in = size;
+    int res;
+    do {
+      stream.next_out = sink.data();
+      stream.avail_out = sink.size();
+      res = deflate( &stream, flush );
+      emp_always_assert( res != Z_STREAM_ERROR );
+      num_deflated_bytes += sink.size() - stream.avail_out;
+    } while (
+      stream.avail_out == 0 || ( flush == Z_FINISH && res != Z_STREAM_END )
+    );
+  }
+
+protected:
+
+  std::streamsize xsputn(
+    const char* data, const std::streamsize size
+  ) override {
+    emp_always_assert( !finished );
+    num_raw_bytes += size;
+    Deflate( data, size, Z_NO_FLUSH );
+    return size;
+  }
+
+  int_type overflow( const int_type ch ) override {
+    if ( traits_type::eq_int_type( ch, traits_type::eof() ) ) {
+      return traits_type::not_eof( ch );
+    }
+    const char c = traits_type::to_char_type( ch );
+    xsputn( &c, 1 );
+    return ch;
+  }
+
+public:
+
+  /// @param level deflate compression level.
+  explicit DeflatedSizeCounter( const int level=Z_DEFAULT_COMPRESSION ) {
+    // 15 + 16 selects a gzip wrapper, matching on-disk .gz size
+    emp_always_assert( deflateInit2(
+      &stream, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY
+    ) == Z_OK );
+  }
+
+  DeflatedSizeCounter( const DeflatedSizeCounter& ) = delete;
+  DeflatedSizeCounter& operator=( const DeflatedSizeCounter& ) = delete;
+
+  ~DeflatedSizeCounter() { deflateEnd( &stream ); }
+
+  /// Flush compressor. Call before GetNumDeflatedBytes.
+  void Finish() {
+    if ( finished ) return;
+    Deflate( nullptr, 0, Z_FINISH );
+    finished = true;
+  }
+
+  /// Begin a new measurement, reusing compressor state allocations.
+  void Reset() {
+    emp_always_assert( deflateReset( &stream ) == Z_OK );
+    num_raw_bytes = 0;
+    num_deflated_bytes = 0;
+    finished = false;
+  }
+
+  size_t GetNumRawBytes() const { return num_raw_bytes; }
+
+  size_t GetNumDeflatedBytes() const {
+    emp_always_assert( finished );
+    return num_deflated_bytes;
+  }
+
+  double GetCompressionRatio() const {
+    return static_cast<double>( GetNumDeflatedBytes() ) / num_raw_bytes;
+  }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_UTILITY_DEFLATEDSIZECOUNTER_HPP_INCLUDE
@@ -0,0 +1,123 @@
+#pragma once
+#ifndef DISH2_UTILITY_HYPERLOGLOG_HPP_INCLUDE
+#define DISH2_UTILITY_HYPERLOGLOG_HPP_INCLUDE
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "murmur_hash_128.hpp"
+
+namespace dish2 {
+
+/// Approximate distinct count in constant memory, after Flajolet et al.
+/// 2007, with linear counting for small cardinalities.
+/// Relative standard error is about 1.04 / sqrt(2^precision).
+/// Sketches of equal precision merge losslessly, so a sketch of a union can
+/// be assembled from sketches of its parts, including across processes by
+/// `MPI_MAX` reduction of registers.
+class HyperLogLog {
+
+  // leading bits of hash select a register
+  size_t precision;
+  // greatest rank observed at each register
+  emp::vector< uint8_t > registers;
+
+  static size_t log2( const size_t num_registers ) {
+    size_t res{};
+    while ( ( size_t{ 1 } << res ) < num_registers ) ++res;
+    return res;
+  }
+
+public:
+
+  static constexpr size_t min_precision = 4;
+  static constexpr size_t max_precision = 18;
+
+  /// @param precision_ log2 of number of registers.
+  explicit HyperLogLog( const size_t precision_ )
+  : precision( precision_ ) {
+    emp_always_assert(
+      precision >= min_precision && precision <= max_precision, precision
+    );
+    registers.resize( size_t{ 1 } << precision );
+  }
+
+  /// Restore sketch from registers, as from GetRegisters.
+  explicit HyperLogLog( emp::vector< uint8_t > registers_ )
+  : precision( log2( registers_.size() ) )
+  , registers( std::move( registers_ ) ) {
+    emp_always_assert(
+      registers.size() == size_t{ 1 } << precision
+      && precision >= min_precision && precision <= max_precision,
+      registers.size()
+    );
+  }
+
+  /// @param hash uniformly distributed hash of item.
+  void Insert( const uint64_t hash ) {
+    const size_t idx = hash >> ( 64 - precision );
+    const uint64_t remainder = hash << precision;
+    // position of first set bit in remainder, saturating if none are set
+    const uint8_t rank = remainder
+      ? __builtin_clzll( remainder ) + 1
+      : 64 - precision + 1;
+    registers[ idx ] = std::max( registers[ idx ], rank );
+  }
+
+  /// Insert item that isn't already a uniformly distributed hash, such as a
+  /// sequential ID.
+  void InsertUnhashed( const uint64_t value ) {
+    Insert( dish2::internal::murmur_hash_128::fmix( value ) );
+  }
+
+  /// Absorb all items inserted into other.
+  void Merge( const HyperLogLog& other ) {
+    emp_assert( precision == other.precision );
+    std::transform(
+      std::begin( registers ), std::end( registers ),
+      std::begin( other.registers ),
+      std::begin( registers ),
+      []( const uint8_t a, const uint8_t b ){ return std::max( a, b ); }
+    );
+  }
+
+  void Clear() {
+    std::fill( std::begin( registers ), std::end( registers ), 0 );
+  }
+
+  double Estimate() const {
+
+    const double m = registers.size();
+
+    double harmonic_sum{};
+    size_t num_zeros{};
+    for ( const auto reg : registers ) {
+      harmonic_sum += std::ldexp( 1.0, -static_cast<int>( reg ) );
+      num_zeros += ( reg == 0 );
+    }
+
+    const double alpha = 0.7213 / ( 1.0 + 1.079 / m );
+    const double raw = alpha * m * m / harmonic_sum;
+
+    // small range correction
+    if ( raw <= 2.5 * m && num_zeros ) return m * std::log( m / num_zeros );
+    else return raw;
+
+  }
+
+  size_t GetPrecision() const { return precision; }
+
+  const emp::vector< uint8_t >& GetRegisters() const { return registers; }
+
+};
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_UTILITY_HYPERLOGLOG_HPP_INCLUDE
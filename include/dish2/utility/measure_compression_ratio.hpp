@@ -2,33 +2,46 @@
 #ifndef DISH2_UTILITY_MEASURE_COMPRESSION_RATIO_HPP_INCLUDE
 #define DISH2_UTILITY_MEASURE_COMPRESSION_RATIO_HPP_INCLUDE
 
-#include <fstream>
+#include <ostream>
 
-#include "../../../third-party/conduit/include/uitsl/fetch/make_temp_filepath.hpp"
-#include "../../../third-party/conduit/include/uitsl/polyfill/filesystem.hpp"
-#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
-#include "../../../third-party/header-only-gzstream/include/hogzstr/gzstream.hpp"
+#include "../../../third-party/cereal/include/cereal/archives/binary.hpp"
+
+#include "DeflatedSizeCounter.hpp"
 
 namespace dish2 {
 
+/// Ratio of gzip-compressed to uncompressed size of val written with
+/// operator<<, measured in memory.
 template< typename T >
 double measure_compression_ratio(const T& val) {
 
-  const std::string uncompressed_path = uitsl::make_temp_filepath();
-  const std::string compressed_path = uitsl::make_temp_filepath();
+  thread_local dish2::DeflatedSizeCounter counter;
+  counter.Reset();
 
-  {
-    std::ofstream uncompressed_handle{ uncompressed_path };
-    uncompressed_handle << val << std::flush;
+  std::ostream os( &counter );
+  os << val << std::flush;
+  counter.Finish();
+
+  return counter.GetCompressionRatio();
+
+}
 
-    hogzstr::ogzstream compressed_handle{ compressed_path };
-    compressed_handle << val << std::flush;
+/// Ratio of gzip-compressed to uncompressed size of val in cereal binary
+/// encoding, serialized straight into the compressor.
+template< typename T >
+double measure_serialized_compression_ratio(const T& val) {
+
+  thread_local dish2::DeflatedSizeCounter counter;
+  counter.Reset();
+
+  {
+    std::ostream os( &counter );
+    cereal::BinaryOutputArchive archive( os );
+    archive( val );
   }
+  counter.Finish();
 
-  return (
-    static_cast<double>( std::filesystem::file_size( compressed_path ) )
-    / std::filesystem::file_size( uncompressed_path )
-  );
+  return counter.GetCompressionRatio();
 
 }
 
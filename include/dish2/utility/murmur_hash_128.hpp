@@ -0,0 +1,95 @@
+#pragma once
+#ifndef DISH2_UTILITY_MURMUR_HASH_128_HPP_INCLUDE
+#define DISH2_UTILITY_MURMUR_HASH_128_HPP_INCLUDE
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include "../../../third-party/Empirical/include/emp/polyfill/span.hpp"
+
+namespace dish2 {
+
+namespace internal::murmur_hash_128 {
+
+constexpr uint64_t rotl( const uint64_t x, const int r ) {
+  return (x << r) | (x >> (64 - r));
+}
+
+constexpr uint64_t fmix( uint64_t k ) {
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdull;
+  k ^= k >> 33;
+  k *= 0xc4ceb9fe1a85ec53ull;
+  k ^= k >> 33;
+  return k;
+}
+
+} // namespace internal::murmur_hash_128
+
+/// MurmurHash3_x64_128 by Austin Appleby, which hashes in a single pass.
+/// @return low and high 64 bits of hash.
+std::pair< uint64_t, uint64_t > murmur_hash_128(
+  const std::span< const std::byte > key, const uint64_t seed=0
+) {
+
+  using namespace internal::murmur_hash_128;
+
+  constexpr uint64_t c1 = 0x87c37b91114253d5ull;
+  constexpr uint64_t c2 = 0x4cf5ad432745937full;
+
+  const size_t num_blocks = key.size() / 16;
+  const std::byte* data = key.data();
+
+  uint64_t h1 = seed;
+  uint64_t h2 = seed;
+
+  for ( size_t i{}; i < num_blocks; ++i ) {
+    uint64_t k1, k2;
+    std::memcpy( &k1, data + 16 * i, sizeof( k1 ) );
+    std::memcpy( &k2, data + 16 * i + 8, sizeof( k2 ) );
+
+    k1 *= c1; k1 = rotl( k1, 31 ); k1 *= c2; h1 ^= k1;
+    h1 = rotl( h1, 27 ); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+
+    k2 *= c2; k2 = rotl( k2, 33 ); k2 *= c1; h2 ^= k2;
+    h2 = rotl( h2, 31 ); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+  }
+
+  // tail bytes, little endian
+  const std::byte* tail = data + 16 * num_blocks;
+  const size_t num_tail = key.size() & 15;
+  uint64_t k1{}, k2{};
+  for ( size_t i = num_tail; i-- > 8; ) {
+    k2 ^= static_cast<uint64_t>( tail[i] ) << ( 8 * (i - 8) );
+  }
+  for ( size_t i = std::min< size_t >( num_tail, 8 ); i--; ) {
+    k1 ^= static_cast<uint64_t>( tail[i] ) << ( 8 * i );
+  }
+  if ( num_tail > 8 ) {
+    k2 *= c2; k2 = rotl( k2, 33 ); k2 *= c1; h2 ^= k2;
+  }
+  if ( num_tail ) {
+    k1 *= c1; k1 = rotl( k1, 31 ); k1 *= c2; h1 ^= k1;
+  }
+
+  h1 ^= key.size();
+  h2 ^= key.size();
+
+  h1 += h2;
+  h2 += h1;
+
+  h1 = fmix( h1 );
+  h2 = fmix( h2 );
+
+  h1 += h2;
+  h2 += h1;
+
+  return { h1, h2 };
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_UTILITY_MURMUR_HASH_128_HPP_INCLUDE
@@ -0,0 +1,65 @@
+#pragma once
+#ifndef DISH2_UTILITY_REDUCE_PARALLEL_HPP_INCLUDE
+#define DISH2_UTILITY_REDUCE_PARALLEL_HPP_INCLUDE
+
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <thread>
+
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+namespace dish2 {
+
+/// Split [first, last) into contiguous chunks, map each chunk on its own
+/// thread, then fold chunk results together in chunk order.
+/// The first chunk is mapped on the calling thread.
+/// @param map callable taking a chunk's first and last iterators and
+/// returning a partial result, called concurrently.
+/// @param reduce callable taking the accumulated result by reference and a
+/// partial result by rvalue reference.
+/// @param num_threads number of chunks, or 0 to use hardware concurrency.
+template< typename RandomIt, typename Map, typename Reduce >
+auto reduce_parallel(
+  const RandomIt first,
+  const RandomIt last,
+  const Map& map,
+  const Reduce& reduce,
+  size_t num_threads=0
+) {
+
+  if ( num_threads == 0 ) num_threads = std::max(
+    std::thread::hardware_concurrency(), 1u
+  );
+
+  const size_t size = std::distance( first, last );
+  num_threads = std::clamp< size_t >( num_threads, 1, std::max< size_t >(
+    size, 1
+  ) );
+
+  const auto chunk_begin = [=]( const size_t chunk ){
+    return std::next( first, chunk * size / num_threads );
+  };
+
+  using result_t = decltype( map( first, last ) );
+  emp::vector< std::future< result_t > > partials;
+  for ( size_t chunk = 1; chunk < num_threads; ++chunk ) {
+    partials.push_back( std::async(
+      std::launch::async,
+      std::cref( map ),
+      chunk_begin( chunk ),
+      chunk_begin( chunk + 1 )
+    ) );
+  }
+
+  result_t res = map( chunk_begin( 0 ), chunk_begin( 1 ) );
+  for ( auto& partial : partials ) reduce( res, partial.get() );
+
+  return res;
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_UTILITY_REDUCE_PARALLEL_HPP_INCLUDE
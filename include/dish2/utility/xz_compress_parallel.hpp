@@ -0,0 +1,122 @@
+#pragma once
+#ifndef DISH2_UTILITY_XZ_COMPRESS_PARALLEL_HPP_INCLUDE
+#define DISH2_UTILITY_XZ_COMPRESS_PARALLEL_HPP_INCLUDE
+
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <lzma.h>
+
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/Empirical/include/emp/base/vector.hpp"
+
+#include "../parallel/ThreadBudget.hpp"
+
+namespace dish2 {
+
+namespace internal {
+
+std::string xz_compress_block( const std::string_view block, const int level ) {
+
+  lzma_options_lzma options;
+  emp_always_assert( !lzma_lzma_preset( &options, level ), level );
+  // dictionary larger than the block only wastes encoder memory
+  options.dict_size = std::clamp(
+    static_cast<uint32_t>( std::min< size_t >( block.size(), UINT32_MAX ) ),
+    static_cast<uint32_t>( LZMA_DICT_SIZE_MIN ),
+    options.dict_size
+  );
+
+  lzma_filter filters[] = {
+    { LZMA_FILTER_LZMA2, &options },
+    { LZMA_VLI_UNKNOWN, nullptr }
+  };
+
+  std::string res( lzma_stream_buffer_bound( block.size() ), '\0' );
+  size_t out_pos{};
+  emp_always_assert( lzma_stream_buffer_encode(
+    filters, LZMA_CHECK_CRC64, nullptr,
+    reinterpret_cast<const uint8_t*>( block.data() ), block.size(),
+    reinterpret_cast<uint8_t*>( res.data() ), &out_pos, res.size()
+  ) == LZMA_OK );
+  res.resize( out_pos );
+
+  return res;
+
+}
+
+} // namespace internal
+
+/// Compress data into a sequence of independent xz streams, one per block,
+/// with blocks compressed concurrently.
+/// Concatenated xz streams form a valid xz file, so output may be appended to
+/// existing .xz files.
+/// Each block is compressed while holding a lease on budget, so callers
+/// sharing a budget together bound peak thread count and encoder memory.
+/// The calling thread takes part in compression.
+std::string xz_compress_parallel(
+  const std::string_view data,
+  const int level,
+  dish2::ThreadBudget& budget,
+  const size_t block_size=8 * 1024 * 1024
+) {
+
+  emp::vector< std::string_view > blocks;
+  for ( size_t pos{}; pos < data.size(); pos += block_size ) {
+    blocks.push_back( data.substr( pos, block_size ) );
+  }
+  // empty input still yields a valid xz stream
+  if ( blocks.empty() ) blocks.push_back( data );
+
+  emp::vector< std::string > compressed( blocks.size() );
+  std::atomic< size_t > next_block{};
+  const auto work = [&](){
+    for (
+      size_t i = next_block++; i < blocks.size(); i = next_block++
+    ) {
+      const dish2::ThreadBudget::Lease lease( budget );
+      compressed[i] = dish2::internal::xz_compress_block( blocks[i], level );
+    }
+  };
+
+  emp::vector< std::future< void > > workers;
+  for (
+    size_t i = 1; i < std::min( budget.GetNumThreads(), blocks.size() ); ++i
+  ) workers.push_back( std::async( std::launch::async, work ) );
+
+  work();
+  for ( auto& worker : workers ) worker.get();
+
+  std::string res;
+  for ( const auto& block : compressed ) res += block;
+  return res;
+
+}
+
+/// Compress data into a sequence of independent xz streams, as above, with a
+/// budget private to this call.
+/// @param num_threads maximum number of blocks compressed at once, or 0 to
+/// use hardware concurrency.
+std::string xz_compress_parallel(
+  const std::string_view data,
+  const int level,
+  size_t num_threads=0,
+  const size_t block_size=8 * 1024 * 1024
+) {
+
+  if ( num_threads == 0 ) num_threads = std::max(
+    std::thread::hardware_concurrency(), 1u
+  );
+
+  dish2::ThreadBudget budget( num_threads );
+  return dish2::xz_compress_parallel( data, level, budget, block_size );
+
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_UTILITY_XZ_COMPRESS_PARALLEL_HPP_INCLUDE
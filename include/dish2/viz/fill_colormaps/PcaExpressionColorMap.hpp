@@ -15,6 +15,7 @@
 #include "../../../../third-party/header-only-pca/include/hopca/normalize.hpp"
 #include "../../../../third-party/header-only-pca/include/hopca/pca.hpp"
 
+#include "../../config/cfg.hpp"
 #include "../../introspection/count_live_cells.hpp"
 #include "../../introspection/make_cardi_coord_to_live_cardi_idx_translator.hpp"
 #include "../../introspection/summarize_module_expression.hpp"
@@ -80,7 +81,7 @@ public:
 
     const auto expression_summary = hopca::drop_homogenous_columns(
       dish2::summarize_module_expression(
-        thread_world.get()
+        thread_world.get(), dish2::cfg.INTROSPECTION_THREADS()
       )
     );
 
@@ -108,6 +108,7 @@ public:
     dish2::Genome< dish2::Spec > genome;
     genome.program = program;
     genome.event_tags = event_tags;
+    genome.RefreshCodingGenotypeHash();
 
     Redraw( genome );
   }
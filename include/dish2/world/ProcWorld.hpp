@@ -19,6 +19,9 @@
 
 #include "../config/cfg.hpp"
 #include "../config/num_cells_global.hpp"
+#include "../parallel/AssignNodeLocalHypercube.hpp"
+#include "../parallel/count_nodes.hpp"
+#include "../parallel/get_node_ids.hpp"
 
 #include "ThreadWorld.hpp"
 
@@ -53,6 +56,21 @@ struct ProcWorld {
     )
   );
 
+  // count_nodes is collective, so evaluate it on every process
+  const bool use_node_local = dish2::cfg.NODE_LOCAL_ASSIGN()
+    && dish2::count_nodes() > 1
+    && !use_metis;
+
+  std::function<uitsl::proc_id_t(size_t)> MakeHypercubeProcAssignment() const {
+    const auto base = netuit::AssignPerfectHypercube<uitsl::proc_id_t>(
+      dish2::cfg.N_DIMS(), dish2::num_cells_global(), uitsl::get_nprocs()
+    );
+    if ( use_node_local ) return dish2::AssignNodeLocalHypercube<
+      uitsl::proc_id_t
+    >( base, dims, dish2::get_node_ids() );
+    else return base;
+  }
+
   const std::pair<
     std::function<uitsl::proc_id_t(size_t)>,
     std::function<uitsl::thread_id_t(size_t)>
@@ -63,13 +81,9 @@ struct ProcWorld {
     topology
   )
   : std::pair{
-    netuit::AssignPerfectHypercube<uitsl::proc_id_t>(
-      dish2::cfg.N_DIMS(), dish2::num_cells_global(), uitsl::get_nprocs()
-    ),
+    MakeHypercubeProcAssignment(),
     uitsl::ThreadUidNormalizer(
-      netuit::AssignPerfectHypercube<uitsl::proc_id_t>(
-        dish2::cfg.N_DIMS(), dish2::num_cells_global(), uitsl::get_nprocs()
-      ),
+      MakeHypercubeProcAssignment(),
       netuit::AssignPerfectHypercube<uitsl::thread_id_t>(
         dish2::cfg.N_DIMS(), dish2::num_cells_global(), total_threads
       )
@@ -77,6 +91,7 @@ struct ProcWorld {
   };
   #else // #ifndef __EMSCRIPTEN__
   const bool use_metis = false;
+  const bool use_node_local = false;
   const std::pair<
     uitsl::AssignIntegrated<uitsl::proc_id_t>,
     uitsl::AssignIntegrated<uitsl::thread_id_t>
@@ -118,7 +133,11 @@ struct ProcWorld {
     assignments.first
   };
 
-  ProcWorld() { if (use_metis) std::cout << "assign used metis" << std::endl; }
+  ProcWorld() {
+    if (use_metis) std::cout << "assign used metis" << std::endl;
+    if (use_node_local) std::cout << "assign used node-local hypercube"
+      << std::endl;
+  }
 
   dish2::ThreadWorld<Spec> MakeThreadWorld(const uitsl::thread_id_t thread_id) {
     return dish2::ThreadWorld<Spec>(
@@ -15,6 +15,10 @@
 #include "../debug/LogScope.hpp"
 #include "../debug/PopulationExtinctionException.hpp"
 #include "../introspection/make_causes_of_death_string_histogram.hpp"
+#include "../phylogeny/PhylogenyTracker.hpp"
+#include "../runninglog/EventStream.hpp"
+#include "../runninglog/RunningLogSummaryCache.hpp"
+#include "../services/ConduitFlushService.hpp"
 
 namespace dish2 {
 
@@ -79,8 +83,14 @@ struct ThreadWorld {
 
   size_t update{};
 
+  // population-wide, combined lazily from per-cell summaries
+  mutable dish2::RunningLogSummaryCache<Spec> running_log_summaries;
+
   template<bool THROW_ON_EXTINCTION=true>
   void Update() {
+    dish2::PhylogenyTracker::Get().Advance( update );
+    dish2::decide_conduit_flushes< Spec >( update );
+
     uitsl::for_each(
       std::begin( population ), std::end( population ),
       sgpl::CountingIterator{},
@@ -90,10 +100,13 @@ struct ThreadWorld {
           "We're having the nth cell run its program and interact with the environment. All cells will take a turn at this one-by-one.",
           3
         };
+        dish2::EventStream<Spec>::Get().SetContext( update, i );
         cell.Update(update);
       }
     );
 
+    running_log_summaries.Invalidate();
+
     if constexpr ( THROW_ON_EXTINCTION ) {
       if ( dish2::cfg.THROW_ON_EXTINCTION() && std::none_of(
         std::begin( population ), std::end( population ),
@@ -113,6 +126,12 @@ struct ThreadWorld {
 
   size_t GetSize() const { return population.size(); }
 
+  /// Summary of all retained running log events of type Event.
+  template< typename Event >
+  dish2::RunningLogSummary< Event > GetRunningLogSummary() const {
+    return running_log_summaries.template Get< Event >( population );
+  }
+
   const dish2::Cell<Spec>& GetCell(const size_t idx) const {
     return population[idx];
   }
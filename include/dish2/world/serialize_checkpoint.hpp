@@ -0,0 +1,111 @@
+#pragma once
+#ifndef DISH2_WORLD_SERIALIZE_CHECKPOINT_HPP_INCLUDE
+#define DISH2_WORLD_SERIALIZE_CHECKPOINT_HPP_INCLUDE
+
+#include <cstdint>
+#include <type_traits>
+
+#include "../../../third-party/cereal/include/cereal/cereal.hpp"
+#include "../../../third-party/Empirical/include/emp/base/always_assert.hpp"
+#include "../../../third-party/signalgp-lite/include/sgpl/utility/ThreadLocalRandom.hpp"
+
+#include "ThreadWorld.hpp"
+
+namespace dish2 {
+
+namespace internal::serialize_checkpoint {
+
+  // T may be const when saving
+  template< typename Archive, typename T >
+  void archive_bytes( Archive& ar, T& val ) {
+    static_assert( std::is_trivially_copyable_v< T > );
+    ar( cereal::binary_data( &val, sizeof( T ) ) );
+  }
+
+  // World may be const when saving
+  template< typename Archive, typename World >
+  void archive_world( Archive& ar, World& world ) {
+
+    uint64_t num_cells = world.population.size();
+    ar( num_cells, world.update );
+    emp_always_assert(
+      num_cells == world.population.size(),
+      "checkpoint population size mismatch",
+      num_cells, world.population.size()
+    );
+
+    for ( auto& cell : world.population ) {
+
+      bool alive = cell.genome.has_value();
+      ar( alive );
+      if constexpr ( Archive::is_loading::value ) {
+        if ( alive ) cell.genome.emplace();
+        else cell.genome.reset();
+      }
+      if ( alive ) {
+        ar( *cell.genome );
+        // not included in genome serialization
+        archive_bytes( ar, cell.genome->kin_group_epoch_stamps );
+      }
+
+      ar( cell.running_logs );
+      archive_bytes( ar, cell.cell_quorum_state );
+
+      for ( auto& cardinal : cell.cardinals ) {
+        archive_bytes( ar, cardinal.peripheral.readable_state );
+        archive_bytes( ar, cardinal.cardinal_quorum_state.learned_bits );
+        ar( cardinal.cardinal_quorum_state.half_trip_counter );
+      }
+
+    }
+
+    // thread local, so must be saved and loaded on the simulation thread
+    archive_bytes( ar, sgpl::tlrand.Get() );
+
+    if constexpr ( Archive::is_loading::value ) {
+      world.running_log_summaries.Invalidate();
+    }
+
+  }
+
+} // namespace internal::serialize_checkpoint
+
+/// Save or load all checkpointed state of a thread world.
+/// Covers update counter, genomes, running logs, quorum state, peripheral
+/// readable state (which includes resource stockpiles), and the calling
+/// thread's random number generator.
+/// CPU cores and messages in flight within conduit ducts are not covered,
+/// so a restored world resumes population state but not the exact
+/// trajectory of the original run.
+/// Must be called on the world's simulation thread.
+/// Binary archives only.
+template< typename Archive, typename Spec >
+void serialize_checkpoint( Archive& ar, dish2::ThreadWorld< Spec >& world ) {
+  internal::serialize_checkpoint::archive_world( ar, world );
+}
+
+/// Save checkpointed state of a thread world, as above, without modifying
+/// it.
+template< typename Archive, typename Spec >
+void serialize_checkpoint(
+  Archive& ar, const dish2::ThreadWorld< Spec >& world
+) {
+  static_assert( Archive::is_saving::value );
+  internal::serialize_checkpoint::archive_world( ar, world );
+}
+
+/// Start every cardinal's CPU fresh from its cell's genome program, as
+/// after loading a checkpoint.
+template< typename Spec >
+void reset_checkpoint_cpus( dish2::ThreadWorld< Spec >& world ) {
+  for ( auto& cell : world.population ) {
+    for ( auto& cardinal : cell.cardinals ) {
+      cardinal.cpu.Reset();
+      if ( cell.IsAlive() ) cardinal.LoadProgram( cell.genome->program );
+    }
+  }
+}
+
+} // namespace dish2
+
+#endif // #ifndef DISH2_WORLD_SERIALIZE_CHECKPOINT_HPP_INCLUDE
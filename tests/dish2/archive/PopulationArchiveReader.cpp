@@ -0,0 +1,70 @@
+#include <cstdio>
+#include <string>
+#include <utility>
+
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "dish2/archive/PopulationArchiveReader.hpp"
+#include "dish2/archive/write_population_archive.hpp"
+#include "dish2/spec/Spec.hpp"
+
+using Spec = dish2::Spec;
+
+const uitsl::MpiGuard guard;
+
+emp::vector< dish2::Genome<Spec> > make_genomes() {
+  emp::vector< dish2::Genome<Spec> > res;
+  for ( size_t i{}; i < 10; ++i ) {
+    res.emplace_back( std::in_place );
+    res.back().root_id.SetID( i * 7 );
+  }
+  return res;
+}
+
+TEST_CASE("Test Round Trip") {
+
+  const auto genomes = make_genomes();
+
+  for ( const int level : { 0, 1, 9 } ) {
+
+    const std::string path = "PopulationArchiveReader.dpa";
+    dish2::write_population_archive<Spec>( path, genomes, level );
+
+    {
+      const dish2::PopulationArchiveReader<Spec> reader( path );
+      REQUIRE( reader.GetNumGenomes() == genomes.size() );
+      REQUIRE( reader.IsCompressed() == ( level > 0 ) );
+
+      // random access, out of order
+      for ( size_t k = genomes.size(); k--; ) {
+        REQUIRE( reader.GetRootID( k ) == genomes[k].root_id.GetID() );
+        REQUIRE( reader.GetGenome( k ) == genomes[k] );
+      }
+
+      REQUIRE( reader.GetGenomes() == genomes );
+    }
+
+    std::remove( path.c_str() );
+
+  }
+
+}
+
+TEST_CASE("Test Empty") {
+
+  const std::string path = "PopulationArchiveReaderEmpty.dpa";
+  dish2::write_population_archive<Spec>( path, {}, 1 );
+
+  {
+    const dish2::PopulationArchiveReader<Spec> reader( path );
+    REQUIRE( reader.GetNumGenomes() == 0 );
+    REQUIRE( reader.GetGenomes().empty() );
+  }
+
+  std::remove( path.c_str() );
+
+}
@@ -0,0 +1,61 @@
+#include <cstring>
+#include <utility>
+
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "dish2/genome/CodingGenotypeHash.hpp"
+#include "dish2/genome/Genome.hpp"
+#include "dish2/spec/Spec.hpp"
+
+using Spec = dish2::Spec;
+
+const uitsl::MpiGuard guard;
+
+TEST_CASE("Test equal programs with different padding") {
+
+  const dish2::Genome<Spec> genome{ std::in_place };
+  using instruction_t = dish2::Genome<Spec>::program_t::value_type;
+
+  emp::vector< instruction_t > zeroed( genome.program.size() );
+  emp::vector< instruction_t > scribbled( genome.program.size() );
+  std::memset( zeroed.data(), 0x00, zeroed.size() * sizeof( instruction_t ) );
+  std::memset(
+    scribbled.data(), 0xAB, scribbled.size() * sizeof( instruction_t )
+  );
+
+  // assign field by field, leaving padding bytes as they were
+  for ( size_t i{}; i < genome.program.size(); ++i ) {
+    for ( auto* program : { &zeroed, &scribbled } ) {
+      ( *program )[i].op_code = genome.program[i].op_code;
+      ( *program )[i].args = genome.program[i].args;
+      ( *program )[i].tag = genome.program[i].tag;
+    }
+  }
+
+  REQUIRE(
+    dish2::CodingGenotypeHash{ genome.event_tags, zeroed }
+    == dish2::CodingGenotypeHash{ genome.event_tags, scribbled }
+  );
+  REQUIRE(
+    dish2::CodingGenotypeHash{ genome.event_tags, zeroed }
+    == genome.GetCodingGenotypeHash()
+  );
+
+}
+
+TEST_CASE("Test different programs") {
+
+  const dish2::Genome<Spec> genome{ std::in_place };
+  auto program = genome.program;
+  program.front().tag.Toggle( 0 );
+
+  REQUIRE(
+    dish2::CodingGenotypeHash{ genome.event_tags, program }
+    != genome.GetCodingGenotypeHash()
+  );
+
+}
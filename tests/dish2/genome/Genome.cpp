@@ -33,5 +33,26 @@ TEST_CASE("Test Serialization") {
   }
 
   REQUIRE( original == dup );
+  REQUIRE(
+    original.GetCodingGenotypeHash() == dup.GetCodingGenotypeHash()
+  );
+
+}
+
+TEST_CASE("Test Coding Genotype Hash") {
+
+  dish2::Genome<Spec> original{ std::in_place };
+
+  auto copy = original;
+  REQUIRE( copy.GetCodingGenotypeHash() == original.GetCodingGenotypeHash() );
+
+  copy.event_tags.tags[0] = ~copy.event_tags.tags[0];
+  copy.RefreshCodingGenotypeHash();
+  REQUIRE( copy.GetCodingGenotypeHash() != original.GetCodingGenotypeHash() );
+
+  copy = original;
+  copy.program.pop_back();
+  copy.RefreshCodingGenotypeHash();
+  REQUIRE( copy.GetCodingGenotypeHash() != original.GetCodingGenotypeHash() );
 
 }
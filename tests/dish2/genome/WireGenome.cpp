@@ -0,0 +1,63 @@
+#include <sstream>
+#include <utility>
+
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "cereal/include/cereal/archives/binary.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+
+#include "dish2/config/TemporaryConfigOverride.hpp"
+#include "dish2/genome/WireGenome.hpp"
+#include "dish2/spec/Spec.hpp"
+
+using Spec = dish2::Spec;
+
+const uitsl::MpiGuard guard;
+
+TEST_CASE("Test Serialization") {
+
+  // uncompressed, fastest, and smallest
+  for ( const int level : { 0, 1, 9 } ) {
+
+    const dish2::TemporaryConfigOverride override{
+      "GENOME_WIRE_COMPRESSION_LEVEL", level
+    };
+
+    const dish2::WireGenome<Spec> original{
+      dish2::Genome<Spec>{ std::in_place }
+    };
+
+    std::stringstream ss;
+
+    {
+      cereal::BinaryOutputArchive oarchive(ss);
+      oarchive(original);
+    }
+
+    dish2::WireGenome<Spec> dup;
+
+    {
+      cereal::BinaryInputArchive iarchive(ss);
+      iarchive(dup);
+    }
+
+    REQUIRE( original == dup );
+
+  }
+
+}
+
+TEST_CASE("Test assignment from Genome") {
+
+  dish2::WireGenome<Spec> wire;
+
+  const dish2::Genome<Spec> first{ std::in_place };
+  wire = first;
+  REQUIRE( static_cast<const dish2::Genome<Spec>&>( wire ) == first );
+
+  const dish2::Genome<Spec> second{ std::in_place };
+  wire = second;
+  REQUIRE( static_cast<const dish2::Genome<Spec>&>( wire ) == second );
+
+}
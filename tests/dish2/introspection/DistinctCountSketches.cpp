@@ -0,0 +1,67 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/uitsl/debug/MultiprocessReporter.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+
+#include "dish2/introspection/count_unique_coding_genotypes.hpp"
+#include "dish2/introspection/count_unique_root_ids.hpp"
+#include "dish2/introspection/DistinctCountSketches.hpp"
+#include "dish2/spec/Spec.hpp"
+#include "dish2/world/ProcWorld.hpp"
+#include "dish2/world/ThreadWorld.hpp"
+
+using Spec = dish2::Spec;
+
+const uitsl::MpiGuard guard;
+
+TEST_CASE("Test DistinctCountSketches register round trip") {
+
+  auto tw = dish2::ProcWorld<Spec>{}.MakeThreadWorld(0);
+  for (size_t i{}; i < 100; ++i) tw.Update();
+
+  dish2::DistinctCountSketches<Spec> sketches( 10 );
+  sketches.Run( tw );
+
+  const auto registers = sketches.GetRegisters();
+  REQUIRE( registers.size() == 5 * 1024 );
+
+  const auto restored
+    = dish2::DistinctCountSketches<Spec>::FromRegisters( registers );
+  REQUIRE( restored.GetRegisters() == registers );
+  REQUIRE(
+    restored.EstimateNumCodingGenotypes()
+    == sketches.EstimateNumCodingGenotypes()
+  );
+  REQUIRE( restored.EstimateNumRootIDs() == sketches.EstimateNumRootIDs() );
+  REQUIRE(
+    restored.EstimateNumModuleRegulationProfiles()
+    == sketches.EstimateNumModuleRegulationProfiles()
+  );
+
+  // small counts are estimated by linear counting, which is close to exact
+  REQUIRE( sketches.EstimateNumCodingGenotypes() == Approx(
+    dish2::count_unique_coding_genotypes<Spec>( tw )
+  ).epsilon( 0.1 ) );
+  REQUIRE( sketches.EstimateNumRootIDs() == Approx(
+    dish2::count_unique_root_ids<Spec>( tw )
+  ).epsilon( 0.1 ) );
+
+}
+
+TEST_CASE("Test DistinctCountSketches parallel") {
+
+  auto tw = dish2::ProcWorld<Spec>{}.MakeThreadWorld(0);
+  for (size_t i{}; i < 100; ++i) tw.Update();
+
+  dish2::DistinctCountSketches<Spec> serial( 10 );
+  serial.Run( tw, 1 );
+
+  // merging by register maximum is independent of how cells are split
+  for ( const size_t num_threads : { 0, 2, 3, 16 } ) {
+    dish2::DistinctCountSketches<Spec> parallel( 10 );
+    parallel.Run( tw, num_threads );
+    REQUIRE( parallel.GetRegisters() == serial.GetRegisters() );
+  }
+
+}
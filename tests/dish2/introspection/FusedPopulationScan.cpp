@@ -0,0 +1,263 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/uitsl/debug/MultiprocessReporter.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <utility>
+
+#include "dish2/introspection/count_cardinals.hpp"
+#include "dish2/introspection/count_dead_cells.hpp"
+#include "dish2/introspection/count_live_cardinals.hpp"
+#include "dish2/introspection/count_live_cells.hpp"
+#include "dish2/introspection/FusedPopulationScan.hpp"
+#include "dish2/introspection/get_fraction_cardinals_apoptosis_request.hpp"
+#include "dish2/introspection/get_fraction_cardinals_receiving_resource.hpp"
+#include "dish2/introspection/get_fraction_cardinals_resource_send_request.hpp"
+#include "dish2/introspection/get_fraction_cardinals_spawn_arrest.hpp"
+#include "dish2/introspection/get_fraction_cardinals_spawn_request.hpp"
+#include "dish2/introspection/get_fraction_cells_apoptosis_request.hpp"
+#include "dish2/introspection/get_fraction_cells_incoming_inter_message.hpp"
+#include "dish2/introspection/get_fraction_cells_receiving_resource.hpp"
+#include "dish2/introspection/get_fraction_cells_resource_send_request.hpp"
+#include "dish2/introspection/get_fraction_cells_spawn_arrest.hpp"
+#include "dish2/introspection/get_fraction_cells_spawn_request.hpp"
+#include "dish2/introspection/get_fraction_fecund_resource_stockpile.hpp"
+#include "dish2/introspection/get_fraction_nulliparous.hpp"
+#include "dish2/introspection/get_mean_cell_age.hpp"
+#include "dish2/introspection/get_mean_elapsed_insertions_deletions.hpp"
+#include "dish2/introspection/get_mean_elapsed_mutation_occurences.hpp"
+#include "dish2/introspection/get_mean_elapsed_point_mutations.hpp"
+#include "dish2/introspection/get_mean_epoch.hpp"
+#include "dish2/introspection/get_mean_incoming_inter_message_count_per_cardinal.hpp"
+#include "dish2/introspection/get_mean_module_count.hpp"
+#include "dish2/introspection/get_mean_program_length.hpp"
+#include "dish2/introspection/get_mean_resource_received_per_cardinal.hpp"
+#include "dish2/introspection/get_mean_resource_received_per_cell.hpp"
+#include "dish2/introspection/get_mean_resource_stockpile.hpp"
+#include "dish2/introspection/get_mean_spawn_count.hpp"
+#include "dish2/introspection/sum_entire_elapsed_instruction_cycles.hpp"
+#include "dish2/record/write_demographic_phenotypic_phylogenetic_metrics.hpp"
+#include "dish2/spec/Spec.hpp"
+#include "dish2/world/ProcWorld.hpp"
+#include "dish2/world/ThreadWorld.hpp"
+
+using Spec = dish2::Spec;
+using scan_t = dish2::FusedPopulationScan< Spec >;
+using cell_t = dish2::Cell< Spec >;
+using world_t = dish2::ThreadWorld< Spec >;
+
+const uitsl::MpiGuard guard;
+
+scan_t make_scan() {
+
+  scan_t scan;
+
+  scan.AddFromCounts( "Number Live Cells",
+    []( const scan_t& scan ){ return scan.GetNumLiveCells(); }
+  );
+
+  scan.AddMeanPerCell( "Mean Cardinals Per Cell", scan_t::Scope::all_cells,
+    []( const cell_t& cell ){ return cell.GetNumCardinals(); }
+  );
+
+  scan.AddMeanPerCell( "Mean Program Length", scan_t::Scope::live_cells,
+    []( const cell_t& cell ){ return cell.genome->program.size(); }
+  );
+
+  scan.AddComputed( "World Size",
+    []( const world_t& world, const scan_t& ){ return world.GetSize(); }
+  );
+
+  return scan;
+
+}
+
+TEST_CASE("Test FusedPopulationScan partial sums") {
+
+  auto tw = dish2::ProcWorld<Spec>{}.MakeThreadWorld(0);
+  for (size_t i{}; i < 50; ++i) tw.Update();
+
+  auto scan = make_scan();
+  scan.Run( tw );
+
+  const auto partial_sums = scan.GetPartialSums();
+  // six counts, then one sum per per-cell metric
+  REQUIRE( partial_sums.size() == 6 + 2 );
+  REQUIRE( partial_sums[0] == tw.GetSize() );
+  REQUIRE( partial_sums[2] == scan.GetNumLiveCells() );
+  REQUIRE( partial_sums[4] == scan.GetNumCardinals() * tw.GetUpdate() );
+
+  // merging a single scan's partial sums reproduces its metrics
+  auto merged = make_scan();
+  merged.Merge( partial_sums, scan.GetUpdate() );
+  REQUIRE( merged.GetUpdate() == scan.GetUpdate() );
+  for ( size_t idx{}; idx < scan.GetNumMetrics(); ++idx ) {
+    if ( merged.IsMergeable( idx ) ) REQUIRE(
+      merged.GetResults()[ idx ].second == scan.GetResults()[ idx ].second
+    );
+    else REQUIRE( std::isnan( merged.GetResults()[ idx ].second ) );
+  }
+
+}
+
+TEST_CASE("Test FusedPopulationScan Merge") {
+
+  auto first = dish2::ProcWorld<Spec>{}.MakeThreadWorld(0);
+  for (size_t i{}; i < 50; ++i) first.Update();
+  auto second = dish2::ProcWorld<Spec>{}.MakeThreadWorld(0);
+  for (size_t i{}; i < 100; ++i) second.Update();
+
+  auto first_scan = make_scan();
+  first_scan.Run( first );
+  auto second_scan = make_scan();
+  second_scan.Run( second );
+
+  auto partial_sums = first_scan.GetPartialSums();
+  const auto second_partial_sums = second_scan.GetPartialSums();
+  std::transform(
+    std::begin( partial_sums ), std::end( partial_sums ),
+    std::begin( second_partial_sums ),
+    std::begin( partial_sums ),
+    std::plus< double >{}
+  );
+
+  auto merged = make_scan();
+  merged.Merge( partial_sums, 50 );
+
+  REQUIRE( merged.GetUpdate() == 50 );
+  REQUIRE( merged.GetNumCells() == first.GetSize() + second.GetSize() );
+  REQUIRE(
+    merged.GetNumCardinals()
+    == first_scan.GetNumCardinals() + second_scan.GetNumCardinals()
+  );
+  REQUIRE(
+    merged.GetNumLiveCells()
+    == first_scan.GetNumLiveCells() + second_scan.GetNumLiveCells()
+  );
+  REQUIRE(
+    merged.GetNumLiveCardinals()
+    == first_scan.GetNumLiveCardinals() + second_scan.GetNumLiveCardinals()
+  );
+  // each scan's cardinals are weighted by that scan's update
+  REQUIRE(
+    merged.GetNumCardinalUpdates()
+    == first_scan.GetNumCardinals() * 50 + second_scan.GetNumCardinals() * 100
+  );
+
+  const auto& results = merged.GetResults();
+  REQUIRE( results[0].second == merged.GetNumLiveCells() );
+  REQUIRE( results[1].second == Approx(
+    merged.GetNumCardinals() / static_cast< double >( merged.GetNumCells() )
+  ) );
+
+  // means over live cells are weighted by each scan's number of live cells
+  const double first_num_live = first_scan.GetNumLiveCells();
+  const double second_num_live = second_scan.GetNumLiveCells();
+  REQUIRE( results[2].second == Approx(
+    (
+      first_scan.GetResults()[2].second * first_num_live
+      + second_scan.GetResults()[2].second * second_num_live
+    ) / ( first_num_live + second_num_live )
+  ) );
+
+  // metrics evaluated after the scan can't be merged
+  REQUIRE( !merged.IsMergeable( 3 ) );
+  REQUIRE( std::isnan( results[3].second ) );
+
+}
+
+TEST_CASE("Test FusedPopulationScan matches free functions") {
+
+  auto tw = dish2::ProcWorld<Spec>{}.MakeThreadWorld(0);
+  for (size_t i{}; i < 100; ++i) tw.Update();
+
+  dish2::internal::DemographicPhenotypicPhylogeneticMetricsState<
+    Spec
+  > state;
+  dish2::internal::register_demographic_phenotypic_phylogenetic_metrics<
+    Spec
+  >( state );
+  state.kin_group_size_stats.Run( tw );
+  state.scan.Run( tw );
+
+  const auto get = [&state]( const std::string& name ){
+    const auto& results = state.scan.GetResults();
+    const auto it = std::find_if(
+      std::begin( results ), std::end( results ),
+      [&name]( const auto& result ){ return result.first == name; }
+    );
+    REQUIRE( it != std::end( results ) );
+    return it->second;
+  };
+
+  const double num_cardinal_updates
+    = dish2::count_cardinals<Spec>( tw ) * tw.GetUpdate();
+
+  // as formerly written, one population pass per metric
+  const std::pair< std::string, double > expected[]{
+    { "Number Cells", tw.GetSize() },
+    { "Number Cardinals", dish2::count_cardinals<Spec>( tw ) },
+    { "Mean Current Epoch", dish2::get_mean_epoch<Spec>( tw ) },
+    { "Mean Elapsed Indel Mutations",
+      dish2::get_mean_elapsed_insertions_deletions<Spec>( tw ) },
+    { "Mean Elapsed Point Mutations",
+      dish2::get_mean_elapsed_point_mutations<Spec>( tw ) },
+    { "Mean Elapsed Mutation Occurences",
+      dish2::get_mean_elapsed_mutation_occurences<Spec>( tw ) },
+    { "Number Dead Cells", dish2::count_dead_cells<Spec>( tw ) },
+    { "Number Live Cells", dish2::count_live_cells<Spec>( tw ) },
+    { "Number Live Cardinals", dish2::count_live_cardinals<Spec>( tw ) },
+    { "Mean Program Module Count", dish2::get_mean_module_count<Spec>( tw ) },
+    { "Mean Program Instruction Count",
+      dish2::get_mean_program_length<Spec>( tw ) },
+    { "Mean Cell Age", dish2::get_mean_cell_age<Spec>( tw ) },
+    { "Mean Resource Stockpile",
+      dish2::get_mean_resource_stockpile<Spec>( tw ) },
+    { "Fecund Resource Stockpile Fraction",
+      dish2::get_fraction_fecund_resource_stockpile<Spec>( tw ) },
+    { "Resource Receiving Cardinal Fraction",
+      dish2::get_fraction_cardinals_receiving_resource<Spec>( tw ) },
+    { "Resource Receiving Cell Fraction",
+      dish2::get_fraction_cells_receiving_resource<Spec>( tw ) },
+    { "Mean Resource Received Per Cardinal",
+      dish2::get_mean_resource_received_per_cardinal<Spec>( tw ) },
+    { "Mean Resource Received Per Cell",
+      dish2::get_mean_resource_received_per_cell<Spec>( tw ) },
+    { "Resource Send Request Cardinal Fraction",
+      dish2::get_fraction_cardinals_resource_send_request<Spec>( tw ) },
+    { "Resource Send Request Cell Fraction",
+      dish2::get_fraction_cells_resource_send_request<Spec>( tw ) },
+    { "Spawn Arrest Cardinal Fraction",
+      dish2::get_fraction_cardinals_spawn_arrest<Spec>( tw ) },
+    { "Spawn Arrest Cell Fraction",
+      dish2::get_fraction_cells_spawn_arrest<Spec>( tw ) },
+    { "Spawn Request Cardinal Fraction",
+      dish2::get_fraction_cardinals_spawn_request<Spec>( tw ) },
+    { "Spawn Request Cell Fraction",
+      dish2::get_fraction_cells_spawn_request<Spec>( tw ) },
+    { "Nulliparous Fraction", dish2::get_fraction_nulliparous<Spec>( tw ) },
+    { "Mean Spawn Count", dish2::get_mean_spawn_count<Spec>( tw ) },
+    { "Cardinal Apoptosis Request Fraction",
+      dish2::get_fraction_cardinals_apoptosis_request<Spec>( tw ) },
+    { "Cell Apoptosis Request Fraction",
+      dish2::get_fraction_cells_apoptosis_request<Spec>( tw ) },
+    { "Mean Incoming Inter Message Count Per Cardinal",
+      dish2::get_mean_incoming_inter_message_count_per_cardinal<Spec>( tw ) },
+    { "Incoming Inter Message Cell Fraction",
+      dish2::get_fraction_cells_incoming_inter_message<Spec>( tw ) },
+    { "Mean Instructions Executed per Cardinal-update",
+      dish2::sum_entire_elapsed_instruction_cycles<Spec>( tw )
+        / num_cardinal_updates },
+  };
+
+  for ( const auto& [name, value] : expected ) {
+    INFO( name );
+    REQUIRE( get( name ) == Approx( value ) );
+  }
+
+}
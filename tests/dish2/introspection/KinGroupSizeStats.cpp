@@ -0,0 +1,59 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/uitsl/debug/MultiprocessReporter.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+
+#include "dish2/introspection/count_live_cells.hpp"
+#include "dish2/introspection/get_fraction_cells_kin_group_loners.hpp"
+#include "dish2/introspection/get_kin_group_sizes.hpp"
+#include "dish2/introspection/get_maximum_kin_group_size.hpp"
+#include "dish2/introspection/get_mean_kin_group_size.hpp"
+#include "dish2/introspection/get_median_kin_group_size.hpp"
+#include "dish2/introspection/get_num_kin_group_loners.hpp"
+#include "dish2/introspection/KinGroupSizeStats.hpp"
+#include "dish2/spec/Spec.hpp"
+#include "dish2/world/ProcWorld.hpp"
+#include "dish2/world/ThreadWorld.hpp"
+
+using Spec = dish2::Spec;
+
+const uitsl::MpiGuard guard;
+
+TEST_CASE("Test KinGroupSizeStats matches free functions") {
+
+  auto tw = dish2::ProcWorld<Spec>{}.MakeThreadWorld(0);
+  dish2::KinGroupSizeStats< Spec > stats;
+
+  // reused stats object must not carry over earlier tallies
+  for ( const size_t num_updates : { 0, 50, 100 } ) {
+
+    while ( tw.GetUpdate() < num_updates ) tw.Update();
+
+    stats.Run( tw );
+    REQUIRE( stats.GetNumLiveCells() == dish2::count_live_cells<Spec>( tw ) );
+
+    for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+      REQUIRE( stats.GetNumGroups( lev )
+        == dish2::get_kin_group_sizes<Spec>( tw, lev ).size()
+      );
+      REQUIRE( stats.GetMaximumSize( lev )
+        == dish2::get_maximum_kin_group_size<Spec>( tw, lev )
+      );
+      REQUIRE( stats.GetMeanSize( lev )
+        == Approx( dish2::get_mean_kin_group_size<Spec>( tw, lev ) )
+      );
+      REQUIRE( stats.GetMedianSize( lev )
+        == dish2::get_median_kin_group_size<Spec>( tw, lev )
+      );
+      REQUIRE( stats.GetNumLoners( lev )
+        == dish2::get_num_kin_group_loners<Spec>( tw, lev )
+      );
+      REQUIRE( stats.GetFractionCellsLoners( lev )
+        == Approx( dish2::get_fraction_cells_kin_group_loners<Spec>( tw, lev ) )
+      );
+    }
+
+  }
+
+}
@@ -0,0 +1,32 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/uitsl/debug/MultiprocessReporter.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+
+#include "dish2/introspection/get_kin_group_sizes.hpp"
+#include "dish2/introspection/get_kin_group_sizes_parallel.hpp"
+#include "dish2/spec/Spec.hpp"
+#include "dish2/world/ProcWorld.hpp"
+#include "dish2/world/ThreadWorld.hpp"
+
+using Spec = dish2::Spec;
+
+const uitsl::MpiGuard guard;
+
+TEST_CASE("Test get_kin_group_sizes_parallel matches serial") {
+
+  auto tw = dish2::ProcWorld<Spec>{}.MakeThreadWorld(0);
+  for (size_t i{}; i < 100; ++i) tw.Update();
+
+  // hardware concurrency, serial, and uneven chunks
+  for ( const size_t num_threads : { 0, 1, 2, 3 } ) {
+    for ( size_t lev{}; lev < Spec::NLEV; ++lev ) {
+      REQUIRE(
+        dish2::get_kin_group_sizes_parallel<Spec>( tw, lev, num_threads )
+        == dish2::get_kin_group_sizes<Spec>( tw, lev )
+      );
+    }
+  }
+
+}
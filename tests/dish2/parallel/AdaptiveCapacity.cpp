@@ -0,0 +1,39 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/uitsl/debug/MultiprocessReporter.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+
+#include "dish2/parallel/AdaptiveCapacity.hpp"
+
+const uitsl::MpiGuard guard;
+
+TEST_CASE("AdaptiveCapacity grows on drops") {
+
+  dish2::AdaptiveCapacity adaptive( 2, 32 );
+  REQUIRE( adaptive.GetCapacity() == 2 );
+
+  for (size_t window{}; window < 10; ++window) {
+    for (size_t i{}; i < 63; ++i) REQUIRE( !adaptive.Record( true, 2 ) );
+    adaptive.Record( false, 2 );
+  }
+
+  REQUIRE( adaptive.GetCapacity() == 32 );
+
+}
+
+TEST_CASE("AdaptiveCapacity shrinks when underused") {
+
+  dish2::AdaptiveCapacity adaptive( 2, 32 );
+
+  for (size_t i{}; i < 64 * 4; ++i) adaptive.Record( false, 2 );
+  REQUIRE( adaptive.GetCapacity() == 32 );
+
+  // peak occupancy of half capacity holds steady
+  for (size_t i{}; i < 64; ++i) REQUIRE( !adaptive.Record( true, 16 ) );
+  REQUIRE( adaptive.GetCapacity() == 32 );
+
+  for (size_t i{}; i < 64 * 10; ++i) adaptive.Record( true, 1 );
+  REQUIRE( adaptive.GetCapacity() == 2 );
+
+}
@@ -0,0 +1,56 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/netuit/assign/AssignPerfectHypercube.hpp"
+#include "conduit/include/uitsl/debug/MultiprocessReporter.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "dish2/parallel/AssignNodeLocalHypercube.hpp"
+
+const uitsl::MpiGuard guard;
+
+template< typename Assign >
+size_t count_cross_node_neighbors(
+  const Assign& assign, const emp::vector< int >& node_ids, const size_t width
+) {
+  size_t res{};
+  for (size_t y{}; y < width; ++y) for (size_t x{}; x < width; ++x) {
+    const size_t cell = x + y * width;
+    const size_t right = (x + 1) % width + y * width;
+    const size_t down = x + (y + 1) % width * width;
+    res += node_ids[ assign( cell ) ] != node_ids[ assign( right ) ];
+    res += node_ids[ assign( cell ) ] != node_ids[ assign( down ) ];
+  }
+  return res;
+}
+
+TEST_CASE("Test AssignNodeLocalHypercube") {
+
+  const size_t width = 16;
+  const emp::vector< size_t > dims{ width, width };
+
+  // 16 procs round-robined across 4 nodes
+  emp::vector< int > node_ids;
+  for (size_t proc{}; proc < 16; ++proc) node_ids.push_back( proc % 4 );
+
+  const netuit::AssignPerfectHypercube<uitsl::proc_id_t> base(
+    dims.size(), width * width, node_ids.size()
+  );
+  const dish2::AssignNodeLocalHypercube<uitsl::proc_id_t> node_local(
+    base, dims, node_ids
+  );
+
+  // every proc should get exactly one block's worth of cells
+  emp::vector< size_t > proc_counts( node_ids.size() );
+  for (size_t cell{}; cell < width * width; ++cell) {
+    ++proc_counts[ node_local( cell ) ];
+  }
+  for (const auto count : proc_counts) REQUIRE( count == width );
+
+  REQUIRE(
+    count_cross_node_neighbors( node_local, node_ids, width )
+    < count_cross_node_neighbors( base, node_ids, width )
+  );
+
+}
@@ -0,0 +1,74 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/uitsl/debug/MultiprocessReporter.hpp"
+#include "conduit/include/uitsl/mpi/comm_utils.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <future>
+
+#include <mpi.h>
+
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "dish2/config/TemporaryConfigOverride.hpp"
+#include "dish2/parallel/GlobalAllreduce.hpp"
+
+const uitsl::MpiGuard guard;
+
+TEST_CASE("Test GlobalAllreduce single thread") {
+
+  const dish2::TemporaryConfigOverride n_threads{ "N_THREADS", 1 };
+
+  dish2::GlobalAllreduce< uint64_t > reduce(
+    MPI_UINT64_T, MPI_MIN,
+    []( const uint64_t a, const uint64_t b ){ return std::min( a, b ); }
+  );
+
+  const uint64_t proc_id = uitsl::get_proc_id();
+  REQUIRE(
+    reduce( { proc_id + 3, 7 } ) == emp::vector< uint64_t >{ 3, 7 }
+  );
+
+}
+
+TEST_CASE("Test GlobalAllreduce multiple threads") {
+
+  const size_t num_threads = 4;
+  const dish2::TemporaryConfigOverride n_threads{ "N_THREADS", num_threads };
+
+  dish2::GlobalAllreduce< double > reduce(
+    MPI_DOUBLE, MPI_SUM, std::plus< double >{}
+  );
+
+  const double num_procs = uitsl::get_nprocs();
+
+  const auto work = [&]( const size_t thread_idx ){
+    // instance is reused for every generation
+    for ( size_t generation{}; generation < 100; ++generation ) {
+      const auto res = reduce( {
+        static_cast< double >( thread_idx ),
+        static_cast< double >( generation ),
+        1.0
+      } );
+      if ( res != emp::vector< double >{
+        num_procs * ( 0 + 1 + 2 + 3 ),
+        num_procs * num_threads * generation,
+        num_procs * num_threads
+      } ) return false;
+    }
+    return true;
+  };
+
+  // every thread must arrive before any thread can leave
+  emp::vector< std::future< bool > > workers;
+  for ( size_t thread_idx{}; thread_idx < num_threads; ++thread_idx ) {
+    workers.push_back( std::async( std::launch::async, work, thread_idx ) );
+  }
+
+  for ( auto& worker : workers ) REQUIRE( worker.get() );
+
+}
@@ -0,0 +1,79 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/uitsl/debug/MultiprocessReporter.hpp"
+#include "conduit/include/uitsl/mpi/comm_utils.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+
+#include "dish2/config/TemporaryConfigOverride.hpp"
+#include "dish2/parallel/SharedWindowBackEnd.hpp"
+#include "dish2/parallel/SharedWindowSlot.hpp"
+
+const uitsl::MpiGuard guard;
+
+struct MockDelegateBackEnd {};
+
+using slot_t = dish2::SharedWindowSlot< int >;
+using back_end_t = dish2::SharedWindowBackEnd<
+  slot_t, MockDelegateBackEnd, 4
+>;
+
+TEST_CASE("SharedWindowBackEnd max capacity") {
+
+  {
+    const dish2::TemporaryConfigOverride adaptive{
+      "DUCT_ADAPTIVE_CAPACITY", false
+    };
+    const back_end_t back_end;
+    REQUIRE( back_end.GetMaxCapacity() == 4 );
+  }
+
+  {
+    const dish2::TemporaryConfigOverride adaptive{
+      "DUCT_ADAPTIVE_CAPACITY", true
+    };
+    const dish2::TemporaryConfigOverride factor{
+      "DUCT_ADAPTIVE_CAPACITY_MAX_FACTOR", 8
+    };
+    const back_end_t back_end;
+    REQUIRE( back_end.GetMaxCapacity() == 32 );
+  }
+
+}
+
+TEST_CASE("SharedWindowBackEnd enabled") {
+
+  {
+    const dish2::TemporaryConfigOverride slots{
+      "SHARED_WINDOW_DUCT_SLOTS", 0
+    };
+    back_end_t back_end;
+    REQUIRE( !back_end.IsEnabled() );
+    REQUIRE( back_end.GetDelegate() );
+  }
+
+  back_end_t back_end;
+  REQUIRE( back_end.IsEnabled() == uitsl::is_multiprocess() );
+  REQUIRE( back_end.GetDelegate() );
+
+}
+
+TEST_CASE("SharedWindowBackEnd claim") {
+
+  back_end_t back_end;
+  if ( !back_end.IsEnabled() ) return;
+
+  const auto proc = uitsl::get_proc_id();
+
+  // both ends of a duct find the same slot
+  auto& inlet_slot = back_end.Claim( proc, proc, 1 );
+  auto& outlet_slot = back_end.Claim( proc, proc, 1 );
+  REQUIRE( &inlet_slot == &outlet_slot );
+  REQUIRE( &back_end.Claim( proc, proc, 2 ) != &inlet_slot );
+
+  REQUIRE( inlet_slot.TryPut( 42 ) );
+  int dest{};
+  REQUIRE( outlet_slot.TryConsumeGets( 1, dest ) == 1 );
+  REQUIRE( dest == 42 );
+
+}
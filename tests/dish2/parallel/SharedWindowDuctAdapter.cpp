@@ -0,0 +1,128 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/uit/setup/InterProcAddress.hpp"
+#include "conduit/include/uitsl/debug/MultiprocessReporter.hpp"
+#include "conduit/include/uitsl/mpi/comm_utils.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+
+#include <memory>
+#include <string>
+
+#include "dish2/config/TemporaryConfigOverride.hpp"
+#include "dish2/parallel/SharedWindowDuctAdapter.hpp"
+
+const uitsl::MpiGuard guard;
+
+// counts puts so tests can tell whether the delegate carried them
+template< typename ImplSpec >
+struct MockDelegateDuct {
+
+  using T = typename ImplSpec::T;
+
+  struct BackEndImpl { size_t num_puts{}; };
+
+  class InletImpl {
+
+    std::shared_ptr< BackEndImpl > back_end;
+
+  public:
+
+    InletImpl(
+      const uit::InterProcAddress&, std::shared_ptr< BackEndImpl > back_end_
+    ) : back_end( back_end_ )
+    { }
+
+    bool TryPut( const T& ) { ++back_end->num_puts; return true; }
+
+    bool TryFlush() { return true; }
+
+    std::string ToString() const { return "mock inlet"; }
+
+  };
+
+  class OutletImpl {
+
+    T val{ -1 };
+
+  public:
+
+    OutletImpl( const uit::InterProcAddress&, std::shared_ptr< BackEndImpl > )
+    { }
+
+    size_t TryConsumeGets( size_t ) { return 0; }
+
+    const T& Get() const { return val; }
+
+    T& Get() { return val; }
+
+    std::string ToString() const { return "mock outlet"; }
+
+  };
+
+};
+
+struct MockImplSpec {
+  using T = int;
+  static constexpr size_t N = 4;
+};
+
+using duct_t = dish2::SharedWindowDuctAdapter<
+  MockDelegateDuct
+>::Duct< MockImplSpec >;
+
+TEST_CASE("SharedWindowDuctAdapter falls back to delegate") {
+
+  // with no shared window, no slot is assigned
+  const dish2::TemporaryConfigOverride slots{ "SHARED_WINDOW_DUCT_SLOTS", 0 };
+
+  const auto back_end = std::make_shared< duct_t::BackEndImpl >();
+  const auto proc = uitsl::get_proc_id();
+  const uit::InterProcAddress address{ proc, proc };
+
+  duct_t::InletImpl inlet( address, back_end );
+  duct_t::OutletImpl outlet( address, back_end );
+
+  REQUIRE( inlet.TryPut( 1 ) );
+  REQUIRE( inlet.TryPut( 2 ) );
+  REQUIRE( back_end->GetDelegate()->num_puts == 2 );
+  REQUIRE( inlet.TryFlush() );
+  REQUIRE( inlet.ToString() == "mock inlet" );
+
+  REQUIRE( outlet.TryConsumeGets( 1 ) == 0 );
+  REQUIRE( outlet.Get() == -1 );
+  REQUIRE( outlet.ToString() == "mock outlet" );
+
+}
+
+TEST_CASE("SharedWindowDuctAdapter uses shared window on node") {
+
+  const dish2::TemporaryConfigOverride adaptive{
+    "DUCT_ADAPTIVE_CAPACITY", false
+  };
+
+  const auto back_end = std::make_shared< duct_t::BackEndImpl >();
+  if ( !back_end->IsEnabled() ) return;
+
+  // a process always shares a node with itself
+  const auto proc = uitsl::get_proc_id();
+  const uit::InterProcAddress address{ proc, proc };
+
+  duct_t::InletImpl inlet( address, back_end );
+  duct_t::OutletImpl outlet( address, back_end );
+
+  // put and get round trip
+  REQUIRE( inlet.TryPut( 1 ) );
+  REQUIRE( inlet.TryPut( 2 ) );
+  REQUIRE( outlet.TryConsumeGets( 10 ) == 2 );
+  REQUIRE( outlet.Get() == 2 );
+
+  // full slot drops puts
+  for ( int i{}; i < 4; ++i ) REQUIRE( inlet.TryPut( i ) );
+  REQUIRE( !inlet.TryPut( 4 ) );
+  REQUIRE( outlet.TryConsumeGets( 10 ) == 4 );
+  REQUIRE( outlet.Get() == 3 );
+
+  REQUIRE( back_end->GetDelegate()->num_puts == 0 );
+
+}
@@ -0,0 +1,116 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/uitsl/debug/MultiprocessReporter.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+
+#include <cstddef>
+#include <new>
+
+#include "dish2/parallel/SharedWindowSlot.hpp"
+
+const uitsl::MpiGuard guard;
+
+using slot_t = dish2::SharedWindowSlot< int >;
+
+// slots are laid out in place, as within a shared window
+struct SlotStorage {
+
+  alignas( slot_t ) std::byte storage[ 1024 ];
+  slot_t& slot;
+
+  explicit SlotStorage( const size_t max_capacity )
+  : slot( *new ( storage ) slot_t( max_capacity ) )
+  { REQUIRE( slot_t::GetStride( max_capacity ) <= sizeof( storage ) ); }
+
+};
+
+TEST_CASE("SharedWindowSlot stride") {
+
+  for ( const size_t max_capacity : { 1, 4, 7, 64 } ) {
+    const size_t stride = slot_t::GetStride( max_capacity );
+    REQUIRE( stride % alignof( slot_t ) == 0 );
+    REQUIRE( stride >= sizeof( slot_t ) + max_capacity * sizeof( int ) );
+  }
+
+}
+
+TEST_CASE("SharedWindowSlot claim") {
+
+  SlotStorage storage( 4 );
+  auto& slot = storage.slot;
+
+  REQUIRE( slot.TryClaim( 7 ) );
+  // claiming again with the same key finds the same duct
+  REQUIRE( slot.TryClaim( 7 ) );
+  REQUIRE( !slot.TryClaim( 8 ) );
+
+}
+
+TEST_CASE("SharedWindowSlot put and get") {
+
+  SlotStorage storage( 4 );
+  auto& slot = storage.slot;
+
+  int dest{};
+  REQUIRE( slot.TryConsumeGets( 1, dest ) == 0 );
+
+  REQUIRE( slot.TryPut( 1 ) );
+  REQUIRE( slot.TryPut( 2 ) );
+  REQUIRE( slot.TryPut( 3 ) );
+  REQUIRE( slot.GetOccupancy() == 3 );
+
+  REQUIRE( slot.TryConsumeGets( 1, dest ) == 1 );
+  REQUIRE( dest == 1 );
+
+  // latest consumed value is kept
+  REQUIRE( slot.TryConsumeGets( 10, dest ) == 2 );
+  REQUIRE( dest == 3 );
+  REQUIRE( slot.GetOccupancy() == 0 );
+
+  // wraps around the ring
+  for ( int i{}; i < 10; ++i ) {
+    REQUIRE( slot.TryPut( i ) );
+    REQUIRE( slot.TryConsumeGets( 1, dest ) == 1 );
+    REQUIRE( dest == i );
+  }
+
+}
+
+TEST_CASE("SharedWindowSlot full slot drops puts") {
+
+  SlotStorage storage( 4 );
+  auto& slot = storage.slot;
+
+  for ( int i{}; i < 4; ++i ) REQUIRE( slot.TryPut( i ) );
+  REQUIRE( !slot.TryPut( 4 ) );
+  REQUIRE( slot.GetOccupancy() == 4 );
+
+  int dest{};
+  REQUIRE( slot.TryConsumeGets( 10, dest ) == 4 );
+  REQUIRE( dest == 3 );
+  REQUIRE( slot.TryPut( 5 ) );
+
+}
+
+TEST_CASE("SharedWindowSlot resize") {
+
+  SlotStorage storage( 4 );
+  auto& slot = storage.slot;
+
+  REQUIRE( slot.TryPut( 1 ) );
+  // capacity can only change while ring is empty
+  REQUIRE( !slot.TryResize( 2 ) );
+
+  int dest{};
+  REQUIRE( slot.TryConsumeGets( 1, dest ) == 1 );
+  REQUIRE( slot.TryResize( 2 ) );
+
+  REQUIRE( slot.TryPut( 2 ) );
+  REQUIRE( slot.TryPut( 3 ) );
+  REQUIRE( !slot.TryPut( 4 ) );
+
+  REQUIRE( slot.TryConsumeGets( 10, dest ) == 2 );
+  REQUIRE( dest == 3 );
+
+}
@@ -0,0 +1,58 @@
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "conduit/include/uitsl/debug/MultiprocessReporter.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "dish2/parallel/ThreadBudget.hpp"
+
+const uitsl::MpiGuard guard;
+
+TEST_CASE("ThreadBudget bounds concurrent leases") {
+
+  dish2::ThreadBudget budget( 3 );
+  REQUIRE( budget.GetNumThreads() == 3 );
+
+  std::atomic< size_t > num_active{};
+  std::atomic< size_t > max_active{};
+
+  emp::vector< std::future< void > > workers;
+  for ( size_t i{}; i < 16; ++i ) workers.push_back( std::async(
+    std::launch::async, [&](){
+      const dish2::ThreadBudget::Lease lease( budget );
+      const size_t active = ++num_active;
+      size_t prev = max_active;
+      while (
+        prev < active && !max_active.compare_exchange_weak( prev, active )
+      );
+      std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+      --num_active;
+    }
+  ) );
+
+  for ( auto& worker : workers ) worker.get();
+
+  REQUIRE( max_active >= 1 );
+  REQUIRE( max_active <= 3 );
+  REQUIRE( num_active == 0 );
+
+}
+
+TEST_CASE("ThreadBudget is at least one") {
+
+  dish2::ThreadBudget budget( 0 );
+  REQUIRE( budget.GetNumThreads() == 1 );
+
+  { const dish2::ThreadBudget::Lease lease( budget ); }
+  // lease was returned, so this doesn't block
+  { const dish2::ThreadBudget::Lease lease( budget ); }
+
+}
@@ -0,0 +1,115 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/optional.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "dish2/config/TemporaryConfigOverride.hpp"
+#include "dish2/genome/TaxonID.hpp"
+#include "dish2/phylogeny/PhylogenyTracker.hpp"
+
+struct Genome { dish2::TaxonID taxon_id; };
+
+struct Cell { emp::optional< Genome > genome; };
+
+struct World {
+  emp::vector< Cell > population;
+  size_t GetUpdate() const { return 0; }
+};
+
+TEST_CASE("Test PhylogenyTracker") {
+
+  const dish2::TemporaryConfigOverride tracking{ "PHYLOGENY_TRACKING", true };
+  const dish2::TemporaryConfigOverride delay{ "PHYLOGENY_PRUNE_DELAY", 2 };
+
+  auto& tracker = dish2::PhylogenyTracker::Get();
+
+  World world{ { Cell{ Genome{} }, Cell{ Genome{} }, Cell{} } };
+  tracker.Open( world );
+  REQUIRE( tracker.GetNumTaxa() == 2 );
+
+  const auto a = world.population[0].genome->taxon_id;
+  const auto b = world.population[1].genome->taxon_id;
+  REQUIRE( a );
+  REQUIRE( b );
+  REQUIRE( a != b );
+
+  tracker.Advance( 1 );
+
+  // mutated offspring found a new taxon
+  const auto c = tracker.RecordBirth( a, true );
+  REQUIRE( c != a );
+  REQUIRE( tracker.GetNumTaxa() == 3 );
+
+  // unmutated offspring join parent taxon
+  REQUIRE( tracker.RecordBirth( a, false ) == a );
+  REQUIRE( tracker.GetNumTaxa() == 3 );
+
+  // extinct leaf is pruned once delay elapses
+  tracker.RecordDeath( b );
+  tracker.Advance( 2 );
+  REQUIRE( tracker.GetNumTaxa() == 3 );
+  tracker.Advance( 3 );
+  REQUIRE( tracker.GetNumTaxa() == 2 );
+
+  // extinct ancestor is retained while it has descendants
+  tracker.RecordDeath( a );
+  tracker.RecordDeath( a );
+  tracker.Advance( 6 );
+  REQUIRE( tracker.GetNumTaxa() == 2 );
+
+  // pruning descendant prunes ancestor too
+  tracker.RecordDeath( c );
+  tracker.Advance( 7 );
+  REQUIRE( tracker.GetNumTaxa() == 2 );
+  tracker.Advance( 8 );
+  REQUIRE( tracker.GetNumTaxa() == 0 );
+
+  // offspring of untracked parent found a new root
+  const dish2::TaxonID remote{ 42 };
+  const auto d = tracker.RecordBirth( remote, false );
+  REQUIRE( d != remote );
+  REQUIRE( tracker.GetNumTaxa() == 1 );
+
+}
+
+TEST_CASE("Test PhylogenyTracker revived taxon") {
+
+  const dish2::TemporaryConfigOverride tracking{ "PHYLOGENY_TRACKING", true };
+  const dish2::TemporaryConfigOverride delay{ "PHYLOGENY_PRUNE_DELAY", 2 };
+
+  auto& tracker = dish2::PhylogenyTracker::Get();
+  World world{};
+  tracker.Open( world );
+
+  tracker.Advance( 10 );
+  const size_t num_taxa = tracker.GetNumTaxa();
+
+  const auto x = tracker.RecordBirth( dish2::TaxonID{ 43 }, false );
+  REQUIRE( tracker.GetNumTaxa() == num_taxa + 1 );
+  tracker.RecordDeath( x );
+
+  // late birth revives queued taxon
+  tracker.Advance( 11 );
+  REQUIRE( tracker.RecordBirth( x, false ) == x );
+
+  // extinct taxon queued behind revived taxon
+  const auto y = tracker.RecordBirth( dish2::TaxonID{ 44 }, false );
+  REQUIRE( tracker.GetNumTaxa() == num_taxa + 2 );
+  tracker.RecordDeath( y );
+
+  // revived lineage stays active, but must not hold up pruning
+  for ( size_t update = 12; update < 20; ++update ) {
+    tracker.Advance( update );
+    REQUIRE( tracker.RecordBirth( x, false ) == x );
+  }
+  REQUIRE( tracker.GetNumTaxa() == num_taxa + 1 );
+
+  // revived taxon is queued again on its next extinction
+  for ( size_t i{}; i < 9; ++i ) tracker.RecordDeath( x );
+  tracker.Advance( 20 );
+  REQUIRE( tracker.GetNumTaxa() == num_taxa + 1 );
+  tracker.Advance( 21 );
+  REQUIRE( tracker.GetNumTaxa() == num_taxa );
+
+}
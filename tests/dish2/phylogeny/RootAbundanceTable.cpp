@@ -0,0 +1,59 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/base/optional.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "dish2/genome/RootID.hpp"
+#include "dish2/phylogeny/RootAbundanceTable.hpp"
+
+struct Genome { dish2::RootID root_id; };
+
+struct Cell {
+  emp::optional< Genome > genome;
+  bool IsAlive() const { return genome.has_value(); }
+};
+
+struct World { emp::vector< Cell > population; };
+
+TEST_CASE("Test RootAbundanceTable") {
+
+  auto& table = dish2::RootAbundanceTable::Get();
+
+  World world{ {
+    Cell{ Genome{ 1 } }, Cell{ Genome{ 1 } }, Cell{ Genome{ 2 } }, Cell{}
+  } };
+  World other{ { Cell{ Genome{ 3 } } } };
+
+  table.Open( world );
+  REQUIRE( table.IsOpenFor( world ) );
+  REQUIRE( !table.IsOpenFor( other ) );
+  REQUIRE( table.GetNumRoots() == 2 );
+  REQUIRE( table.GetNumLiveCells() == 3 );
+  REQUIRE( table.GetCount( 1 ) == 2 );
+  REQUIRE( table.GetCount( 2 ) == 1 );
+  REQUIRE( table.GetCount( 3 ) == 0 );
+
+  // root 2 goes extinct
+  table.RecordDeath( world.population[2] );
+  world.population[2].genome.reset();
+  REQUIRE( table.GetNumRoots() == 1 );
+  REQUIRE( table.GetNumLiveCells() == 2 );
+
+  // offspring of root 1 replaces empty cell
+  world.population[3].genome = Genome{ 1 };
+  table.RecordBirth( world.population[3] );
+  REQUIRE( table.GetCount( 1 ) == 3 );
+
+  // cells outside tracked world are ignored
+  table.RecordDeath( other.population[0] );
+  table.RecordBirth( other.population[0] );
+  REQUIRE( table.GetNumRoots() == 1 );
+  REQUIRE( table.GetCount( 3 ) == 0 );
+
+  table.RecordBirth( world.population[2] = Cell{ Genome{ 4 } } );
+  REQUIRE( table.GetSortedCounts() == emp::vector< std::pair<size_t, size_t> >{
+    { 1, 3 }, { 4, 1 }
+  } );
+
+}
@@ -0,0 +1,45 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "dish2/config/TemporaryConfigOverride.hpp"
+#include "dish2/enum/CauseOfDeath.hpp"
+#include "dish2/runninglog/DeathEvent.hpp"
+#include "dish2/runninglog/DeathEventSummary.hpp"
+#include "dish2/runninglog/RunningLog.hpp"
+#include "dish2/spec/Spec.hpp"
+
+using Spec = dish2::Spec;
+using event_t = dish2::DeathEvent< Spec >;
+
+TEST_CASE("Test DeathEventSummary") {
+
+  const dish2::TemporaryConfigOverride override{ "RUNNING_LOG_DURATION", 1 };
+
+  dish2::RunningLog< event_t > log{};
+
+  log.Record( event_t{ dish2::CauseOfDeath::age, {} } );
+  log.Record( event_t{ dish2::CauseOfDeath::apoptosis, {} } );
+  log.Record( event_t{ dish2::CauseOfDeath::apoptosis, {} } );
+  log.Purge();
+
+  REQUIRE( log.GetSummary().GetSize() == 3 );
+  REQUIRE( log.GetSummary().GetSize( dish2::CauseOfDeath::age ) == 1 );
+  REQUIRE( log.GetSummary().GetSize( dish2::CauseOfDeath::apoptosis ) == 2 );
+  REQUIRE( log.GetSummary().GetSize( dish2::CauseOfDeath::elimination ) == 0 );
+
+  // expired events are removed from the summary
+  log.Record( event_t{ dish2::CauseOfDeath::elimination, {} } );
+  log.Purge();
+
+  REQUIRE( log.GetSummary().GetSize() == 1 );
+  REQUIRE( log.GetSummary().GetSize( dish2::CauseOfDeath::age ) == 0 );
+  REQUIRE( log.GetSummary().GetSize( dish2::CauseOfDeath::apoptosis ) == 0 );
+  REQUIRE( log.GetSummary().GetSize( dish2::CauseOfDeath::elimination ) == 1 );
+
+  log.Purge();
+
+  REQUIRE( log.GetSummary().GetSize() == 0 );
+  REQUIRE( log.GetSummary().GetSize( dish2::CauseOfDeath::elimination ) == 0 );
+
+}
@@ -0,0 +1,135 @@
+#define CATCH_CONFIG_MAIN
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+#include <lzma.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "cereal/include/cereal/archives/binary.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+#include "conduit/include/uitsl/polyfill/filesystem.hpp"
+
+#include "dish2/config/TemporaryConfigOverride.hpp"
+#include "dish2/record/AsyncDumpQueue.hpp"
+#include "dish2/record/make_filename/make_data_path.hpp"
+#include "dish2/record/make_filename/make_event_stream_filename.hpp"
+#include "dish2/runninglog/EventStream.hpp"
+#include "dish2/spec/Spec.hpp"
+#include "dish2/utility/pare_keyname_filename.hpp"
+
+using Spec = dish2::Spec;
+
+const uitsl::MpiGuard guard;
+
+std::string xz_decompress( const std::string& compressed ) {
+
+  lzma_stream stream = LZMA_STREAM_INIT;
+  REQUIRE( lzma_stream_decoder(
+    &stream, UINT64_MAX, LZMA_CONCATENATED
+  ) == LZMA_OK );
+
+  stream.next_in = reinterpret_cast<const uint8_t*>( compressed.data() );
+  stream.avail_in = compressed.size();
+
+  std::string res;
+  std::string buffer( 4096, '\0' );
+  lzma_ret ret{ LZMA_OK };
+  while ( ret == LZMA_OK ) {
+    stream.next_out = reinterpret_cast<uint8_t*>( buffer.data() );
+    stream.avail_out = buffer.size();
+    ret = lzma_code( &stream, LZMA_FINISH );
+    res.append( buffer.data(), buffer.size() - stream.avail_out );
+  }
+  REQUIRE( ret == LZMA_STREAM_END );
+
+  lzma_end( &stream );
+  return res;
+
+}
+
+TEST_CASE("Test round trip") {
+
+  const dish2::TemporaryConfigOverride enable{ "EVENT_STREAM", true };
+  // flush every record to exercise the backlog bound
+  const dish2::TemporaryConfigOverride flush{ "EVENT_STREAM_FLUSH_BYTES", 1 };
+
+  std::filesystem::create_directories( dish2::make_data_path() );
+
+  auto& stream = dish2::EventStream< Spec >::Get();
+  stream.Open( 0 );
+  REQUIRE( stream.IsOpen() );
+
+  const size_t num_updates = 10;
+  for ( size_t update{}; update < num_updates; ++update ) {
+    stream.SetContext( update, update + 1 );
+    stream.Record( dish2::BirthEvent< Spec >{ update, 1, 2, {}, 3 } );
+    stream.Record( dish2::DeathEvent< Spec >{
+      dish2::CauseOfDeath::apoptosis, {}
+    } );
+    stream.Record( dish2::SpawnEvent< Spec >{ 4, 5, 6, update, {}, 7 } );
+  }
+  stream.Flush();
+  dish2::AsyncDumpQueue::Get().Wait();
+
+  const std::string filename = dish2::make_data_path(
+    dish2::pare_keyname_filename(
+      dish2::make_event_stream_filename( 0 ), dish2::make_data_path()
+    )
+  );
+  std::ifstream file( filename, std::ios::binary );
+  REQUIRE( file );
+
+  std::istringstream decompressed( xz_decompress( std::string(
+    std::istreambuf_iterator<char>( file ), std::istreambuf_iterator<char>()
+  ) ) );
+
+  std::string magic( 8, '\0' );
+  decompressed.read( magic.data(), magic.size() );
+  REQUIRE( magic == std::string( "DISH2ES", 8 ) );
+
+  cereal::BinaryInputArchive archive( decompressed );
+
+  uint32_t version, nlev, birth_size, death_size, spawn_size;
+  archive( version, nlev, birth_size, death_size, spawn_size );
+  REQUIRE( version == 1 );
+  REQUIRE( nlev == Spec::NLEV );
+  REQUIRE( birth_size );
+  REQUIRE( death_size );
+  REQUIRE( spawn_size );
+
+  for ( size_t update{}; update < num_updates; ++update ) {
+    for ( uint8_t expected_type{}; expected_type < 3; ++expected_type ) {
+      uint8_t type;
+      uint64_t record_update;
+      uint32_t cell_idx;
+      archive( type, record_update, cell_idx );
+      REQUIRE( type == expected_type );
+      REQUIRE( record_update == update );
+      REQUIRE( cell_idx == update + 1 );
+
+      if ( type == 0 ) {
+        dish2::BirthEvent< Spec > birth;
+        archive( birth );
+        REQUIRE( birth.kin_id_commonality_daughter_eliminated == update );
+        REQUIRE( birth.replev == 3 );
+      } else if ( type == 1 ) {
+        dish2::DeathEvent< Spec > death;
+        archive( death );
+        REQUIRE( death.cause_of_death == dish2::CauseOfDeath::apoptosis );
+      } else {
+        dish2::SpawnEvent< Spec > spawn;
+        archive( spawn );
+        REQUIRE( spawn.num_neighbors_parent == update );
+        REQUIRE( spawn.replev == 7 );
+      }
+    }
+  }
+
+  // no trailing records
+  REQUIRE( decompressed.peek() == std::char_traits<char>::eof() );
+
+}
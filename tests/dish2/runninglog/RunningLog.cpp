@@ -4,6 +4,7 @@
 
 #include "Catch/single_include/catch2/catch.hpp"
 #include "Empirical/include/emp/base/vector.hpp"
+#include "Empirical/include/emp/tools/string_utils.hpp"
 
 #include "dish2/config/TemporaryConfigOverride.hpp"
 #include "dish2/runninglog/RunningLog.hpp"
@@ -87,3 +88,48 @@ TEST_CASE("Test RunningLog") {
 
 
 }
+
+TEST_CASE("Test RunningLog growth") {
+
+  const dish2::TemporaryConfigOverride override{ "RUNNING_LOG_DURATION", 1 };
+
+  dish2::RunningLog< std::string > log{};
+
+  // record enough events to wrap and grow the ring buffer repeatedly
+  for ( size_t epoch{}; epoch < 10; ++epoch ) {
+    for ( size_t i{}; i < 3 * epoch; ++i ) {
+      log.Record( emp::to_string( epoch, '.', i ) );
+    }
+    log.Purge();
+  }
+
+  // with duration 1, only events recorded just before the last purge remain
+  emp::vector<std::string> expected;
+  for ( size_t i = 3 * 9; i--; ) {
+    expected.push_back( emp::to_string( 9, '.', i ) );
+  }
+  REQUIRE( expected.size() == 27 );
+
+  REQUIRE( log.GetSize() == expected.size() );
+  REQUIRE( log.GetSummary().GetSize() == expected.size() );
+  REQUIRE(
+    emp::vector<std::string>( std::begin(log), std::end(log) ) == expected
+  );
+
+  const auto copy = log;
+  REQUIRE(
+    emp::vector<std::string>( std::begin(copy), std::end(copy) ) == expected
+  );
+
+  log.Purge();
+  log.Purge();
+
+  REQUIRE( log.GetSize() == 0 );
+  REQUIRE( log.GetSummary().GetSize() == 0 );
+  REQUIRE( copy.GetSummary().GetSize() == expected.size() );
+  REQUIRE( std::begin(log) == std::end(log) );
+  REQUIRE(
+    emp::vector<std::string>( std::begin(copy), std::end(copy) ) == expected
+  );
+
+}
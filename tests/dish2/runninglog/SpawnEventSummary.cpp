@@ -0,0 +1,121 @@
+#define CATCH_CONFIG_MAIN
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "dish2/config/TemporaryConfigOverride.hpp"
+#include "dish2/runninglog/RunningLog.hpp"
+#include "dish2/runninglog/SpawnEvent.hpp"
+#include "dish2/runninglog/SpawnEventSummary.hpp"
+#include "dish2/spec/Spec.hpp"
+
+using Spec = dish2::Spec;
+using event_t = dish2::SpawnEvent< Spec >;
+
+constexpr size_t NLEV = Spec::NLEV;
+static_assert( NLEV > 1 );
+
+// kin id commonalities, neighbor count, uniform peripherality, and replev
+event_t make_event(
+  const size_t commonality,
+  const size_t num_neighbors,
+  const size_t peripherality,
+  const size_t replev
+) {
+  event_t res{ 0, 0, commonality, num_neighbors, {}, replev };
+  res.peripherality_parent.fill( peripherality );
+  return res;
+}
+
+TEST_CASE("Test SpawnEventSummary") {
+
+  const dish2::TemporaryConfigOverride override{ "RUNNING_LOG_DURATION", 1 };
+
+  dish2::RunningLog< event_t > log{};
+
+  log.Record( make_event( NLEV, 4, 1, 0 ) );
+  log.Record( make_event( 0, 2, 2, NLEV ) );
+  log.Record( make_event( 1, 3, 0, 0 ) );
+  log.Purge();
+
+  {
+    const auto& summary = log.GetSummary();
+
+    REQUIRE( summary.GetSize() == 3 );
+    REQUIRE( summary.GetSize( 0 ) == 2 );
+    REQUIRE( summary.GetSize( 1 ) == 0 );
+    REQUIRE( summary.GetSize( NLEV ) == 1 );
+
+    REQUIRE( summary.GetNumNeighbors() == 9 );
+    REQUIRE( summary.GetNumNeighbors( 0 ) == 7 );
+    REQUIRE( summary.GetNumNeighbors( NLEV ) == 2 );
+
+    for ( size_t lev{}; lev < NLEV; ++lev ) {
+      REQUIRE( summary.GetNumKinNeighbors( lev ) == 6 );
+      REQUIRE( summary.GetNumKinNeighbors( lev, 0 ) == 6 );
+      REQUIRE( summary.GetNumKinNeighbors( lev, NLEV ) == 0 );
+    }
+
+    REQUIRE( summary.GetNumKinEliminated( 0 ) == 3 );
+    REQUIRE( summary.GetNumKinEliminated( 1 ) == 2 );
+    REQUIRE( summary.GetNumKinEliminated( NLEV ) == 1 );
+    REQUIRE( summary.GetNumKinEliminated( 0, 0 ) == 2 );
+    REQUIRE( summary.GetNumKinEliminated( 0, NLEV ) == 1 );
+    REQUIRE( summary.GetNumKinEliminated( 1, NLEV ) == 0 );
+    REQUIRE( summary.GetNumKinEliminated( NLEV, 0 ) == 1 );
+  }
+
+  // expired events are removed from the summary
+  log.Record( make_event( 0, 5, 4, 1 ) );
+  log.Purge();
+
+  {
+    const auto& summary = log.GetSummary();
+
+    REQUIRE( summary.GetSize() == 1 );
+    REQUIRE( summary.GetSize( 0 ) == 0 );
+    REQUIRE( summary.GetSize( 1 ) == 1 );
+    REQUIRE( summary.GetNumNeighbors() == 5 );
+    REQUIRE( summary.GetNumNeighbors( 0 ) == 0 );
+    for ( size_t lev{}; lev < NLEV; ++lev ) {
+      REQUIRE( summary.GetNumKinNeighbors( lev ) == 1 );
+      REQUIRE( summary.GetNumKinNeighbors( lev, 1 ) == 1 );
+    }
+    REQUIRE( summary.GetNumKinEliminated( 0 ) == 1 );
+    REQUIRE( summary.GetNumKinEliminated( 1 ) == 0 );
+  }
+
+  log.Purge();
+
+  {
+    const auto& summary = log.GetSummary();
+
+    REQUIRE( summary.GetSize() == 0 );
+    REQUIRE( summary.GetNumNeighbors() == 0 );
+    for ( size_t lev{}; lev < NLEV; ++lev ) {
+      REQUIRE( summary.GetNumKinNeighbors( lev ) == 0 );
+    }
+    REQUIRE( summary.GetNumKinEliminated( 0 ) == 0 );
+  }
+
+}
+
+TEST_CASE("Test SpawnEventSummary merge") {
+
+  using summary_t = dish2::RunningLogSummary< event_t >;
+
+  summary_t first;
+  first.Add( make_event( NLEV, 4, 1, 0 ) );
+
+  summary_t second;
+  second.Add( make_event( 0, 2, 2, NLEV ) );
+  second.Add( make_event( 1, 3, 0, 0 ) );
+
+  first += second;
+
+  REQUIRE( first.GetSize() == 3 );
+  REQUIRE( first.GetNumNeighbors( 0 ) == 7 );
+  REQUIRE( first.GetNumKinNeighbors( 0 ) == 6 );
+  REQUIRE( first.GetNumKinEliminated( 1 ) == 2 );
+  REQUIRE( first.GetNumKinEliminated( 0, NLEV ) == 1 );
+
+}
@@ -0,0 +1,60 @@
+#define CATCH_CONFIG_MAIN
+
+#include <cstdio>
+#include <string>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "dish2/utility/ColumnarDataFile.hpp"
+#include "dish2/utility/ColumnarDataFileReader.hpp"
+
+void write_rows( const std::string& path, const int level ) {
+
+  std::string metric;
+  double value;
+  size_t cell_idx;
+
+  dish2::ColumnarDataFile file( path, 3, level );
+  file.AddVal( 42, "Stint" );
+  file.AddVar( metric, "Metric" );
+  file.AddVar( value, "Value" );
+  file.AddVar( cell_idx, "Cell" );
+  file.PrintHeaderKeys();
+
+  for ( size_t i{}; i < 10; ++i ) {
+    metric = i % 2 ? "Cell Age" : "Spawn Count";
+    value = i * 0.5;
+    cell_idx = i;
+    file.Update();
+  }
+
+}
+
+TEST_CASE("Test round trip") {
+
+  for ( const int level : { 0, 1, 9 } ) {
+
+    const std::string path = "ColumnarDataFile.dcf";
+    write_rows( path, level );
+
+    const dish2::ColumnarDataFileReader reader( path );
+    REQUIRE( reader.GetNumRows() == 10 );
+    REQUIRE( reader.GetConstant( "Stint" ) == "42" );
+    REQUIRE( reader.GetColumnNames() == emp::vector< std::string >{
+      "Metric", "Value", "Cell"
+    } );
+
+    const auto metrics = reader.GetStringColumn( "Metric" );
+    const auto values = reader.GetDoubleColumn( "Value" );
+    const auto cells = reader.GetUIntColumn( "Cell" );
+    for ( size_t i{}; i < 10; ++i ) {
+      REQUIRE( metrics[i] == ( i % 2 ? "Cell Age" : "Spawn Count" ) );
+      REQUIRE( values[i] == i * 0.5 );
+      REQUIRE( cells[i] == i );
+    }
+
+    std::remove( path.c_str() );
+
+  }
+
+}
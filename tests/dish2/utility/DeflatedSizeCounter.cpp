@@ -0,0 +1,49 @@
+#define CATCH_CONFIG_MAIN
+
+#include <ostream>
+#include <random>
+#include <string>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "dish2/utility/DeflatedSizeCounter.hpp"
+#include "dish2/utility/measure_compression_ratio.hpp"
+
+TEST_CASE("Test DeflatedSizeCounter") {
+
+  dish2::DeflatedSizeCounter counter;
+
+  std::ostream os( &counter );
+  for ( size_t i{}; i < 10000; ++i ) os << "duck waddle quack ";
+  os << std::flush;
+  counter.Finish();
+
+  REQUIRE( counter.GetNumRawBytes() == 10000 * 18 );
+  REQUIRE( counter.GetNumDeflatedBytes() > 0 );
+  REQUIRE( counter.GetCompressionRatio() < 0.01 );
+
+  // reset counter is reusable
+  counter.Reset();
+  os << "waddle" << std::flush;
+  counter.Finish();
+  REQUIRE( counter.GetNumRawBytes() == 6 );
+
+}
+
+TEST_CASE("Test measure_compression_ratio") {
+
+  std::mt19937 gen;
+  std::string incompressible;
+  for ( size_t i{}; i < 100000; ++i ) incompressible += static_cast<char>(
+    gen()
+  );
+
+  REQUIRE(
+    dish2::measure_compression_ratio( incompressible )
+    == Approx( 1.0 ).epsilon( 0.01 )
+  );
+  REQUIRE(
+    dish2::measure_compression_ratio( std::string( 100000, 'a' ) ) < 0.01
+  );
+
+}
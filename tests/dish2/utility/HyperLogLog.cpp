@@ -0,0 +1,61 @@
+#define CATCH_CONFIG_MAIN
+
+#include <cmath>
+#include <cstdint>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "dish2/utility/HyperLogLog.hpp"
+
+TEST_CASE("Test HyperLogLog empty") {
+
+  const dish2::HyperLogLog sketch( 10 );
+  REQUIRE( sketch.Estimate() == 0.0 );
+
+}
+
+TEST_CASE("Test HyperLogLog estimate") {
+
+  for ( const size_t num_items : { 10, 1000, 100000 } ) {
+    dish2::HyperLogLog sketch( 12 );
+    // duplicates shouldn't affect estimate
+    for ( size_t rep{}; rep < 3; ++rep ) {
+      for ( size_t item{}; item < num_items; ++item ) {
+        sketch.InsertUnhashed( item );
+      }
+    }
+    // expected relative standard error is about 1.6%
+    REQUIRE( std::abs( sketch.Estimate() - num_items ) < 0.08 * num_items );
+  }
+
+}
+
+TEST_CASE("Test HyperLogLog merge") {
+
+  dish2::HyperLogLog whole( 12 ), first( 12 ), second( 12 );
+  for ( size_t item{}; item < 20000; ++item ) {
+    whole.InsertUnhashed( item );
+    // halves overlap
+    if ( item < 12000 ) first.InsertUnhashed( item );
+    if ( item >= 8000 ) second.InsertUnhashed( item );
+  }
+
+  first.Merge( second );
+  REQUIRE( first.GetRegisters() == whole.GetRegisters() );
+  REQUIRE( first.Estimate() == whole.Estimate() );
+
+}
+
+TEST_CASE("Test HyperLogLog restore from registers") {
+
+  dish2::HyperLogLog sketch( 8 );
+  for ( size_t item{}; item < 500; ++item ) sketch.InsertUnhashed( item );
+
+  const dish2::HyperLogLog restored( sketch.GetRegisters() );
+  REQUIRE( restored.GetPrecision() == 8 );
+  REQUIRE( restored.Estimate() == sketch.Estimate() );
+
+  sketch.Clear();
+  REQUIRE( sketch.Estimate() == 0.0 );
+
+}
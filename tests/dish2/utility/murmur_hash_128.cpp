@@ -0,0 +1,41 @@
+#define CATCH_CONFIG_MAIN
+
+#include <string>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "dish2/utility/murmur_hash_128.hpp"
+
+std::pair< uint64_t, uint64_t > hash( const std::string& str ) {
+  return dish2::murmur_hash_128( std::span<const std::byte>(
+    reinterpret_cast<const std::byte*>( str.data() ), str.size()
+  ) );
+}
+
+TEST_CASE("Test murmur_hash_128 reference values") {
+
+  REQUIRE( hash( "" ) == std::pair< uint64_t, uint64_t >{ 0, 0 } );
+  REQUIRE( hash( "hello" ) == std::pair< uint64_t, uint64_t >{
+    0xcbd8a7b341bd9b02ull, 0x5b1e906a48ae1d19ull
+  } );
+  REQUIRE(
+    hash( "The quick brown fox jumps over the lazy dog" )
+    == std::pair< uint64_t, uint64_t >{
+      0xe34bbc7bbc071b6cull, 0x7a433ca9c49a9347ull
+    }
+  );
+
+}
+
+TEST_CASE("Test murmur_hash_128 seed") {
+
+  const std::string str = "waddle";
+  const std::span<const std::byte> bytes(
+    reinterpret_cast<const std::byte*>( str.data() ), str.size()
+  );
+
+  REQUIRE(
+    dish2::murmur_hash_128( bytes, 1 ) != dish2::murmur_hash_128( bytes, 2 )
+  );
+
+}
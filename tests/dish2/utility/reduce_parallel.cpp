@@ -0,0 +1,59 @@
+#define CATCH_CONFIG_MAIN
+
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "Catch/single_include/catch2/catch.hpp"
+
+#include "dish2/utility/reduce_parallel.hpp"
+
+const auto sum = []( const auto first, const auto last ){
+  return std::accumulate( first, last, size_t{} );
+};
+
+const auto add = []( size_t& accumulator, const size_t partial ){
+  accumulator += partial;
+};
+
+TEST_CASE("Test reduce_parallel sum") {
+
+  std::vector< size_t > data( 10007 );
+  std::iota( std::begin( data ), std::end( data ), 0 );
+
+  for ( const size_t num_threads : { 0, 1, 2, 3, 16 } ) {
+    REQUIRE( dish2::reduce_parallel(
+      std::begin( data ), std::end( data ), sum, add, num_threads
+    ) == 10007 * 10006 / 2 );
+  }
+
+}
+
+TEST_CASE("Test reduce_parallel chunk order") {
+
+  const std::string data{ "abcdefghijklmnopqrstuvwxyz" };
+
+  for ( const size_t num_threads : { 1, 4, 26, 100 } ) {
+    REQUIRE( dish2::reduce_parallel(
+      std::begin( data ), std::end( data ),
+      []( const auto first, const auto last ){
+        return std::string( first, last );
+      },
+      []( std::string& accumulator, std::string&& partial ){
+        accumulator += partial;
+      },
+      num_threads
+    ) == data );
+  }
+
+}
+
+TEST_CASE("Test reduce_parallel empty range") {
+
+  const std::vector< size_t > data;
+
+  REQUIRE( dish2::reduce_parallel(
+    std::begin( data ), std::end( data ), sum, add, 4
+  ) == 0 );
+
+}
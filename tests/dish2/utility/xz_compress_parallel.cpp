@@ -0,0 +1,84 @@
+#define CATCH_CONFIG_MAIN
+
+#include <cstdint>
+#include <string>
+
+#include <lzma.h>
+
+#include "Catch/single_include/catch2/catch.hpp"
+#include "Empirical/include/emp/tools/string_utils.hpp"
+
+#include "dish2/parallel/ThreadBudget.hpp"
+#include "dish2/utility/xz_compress_parallel.hpp"
+
+std::string xz_decompress( const std::string& compressed ) {
+
+  lzma_stream stream = LZMA_STREAM_INIT;
+  REQUIRE( lzma_stream_decoder(
+    &stream, UINT64_MAX, LZMA_CONCATENATED
+  ) == LZMA_OK );
+
+  stream.next_in = reinterpret_cast<const uint8_t*>( compressed.data() );
+  stream.avail_in = compressed.size();
+
+  std::string res;
+  std::string buffer( 4096, '\0' );
+  lzma_ret ret{ LZMA_OK };
+  while ( ret == LZMA_OK ) {
+    stream.next_out = reinterpret_cast<uint8_t*>( buffer.data() );
+    stream.avail_out = buffer.size();
+    ret = lzma_code( &stream, LZMA_FINISH );
+    res.append( buffer.data(), buffer.size() - stream.avail_out );
+  }
+  REQUIRE( ret == LZMA_STREAM_END );
+
+  lzma_end( &stream );
+  return res;
+
+}
+
+TEST_CASE("Test round trip") {
+
+  std::string data;
+  for ( size_t i{}; i < 100000; ++i ) data += emp::to_string( i * i, ',' );
+
+  // small blocks and few threads exercise multiple waves
+  const std::string compressed = dish2::xz_compress_parallel(
+    data, 6, 2, 10000
+  );
+  REQUIRE( compressed.size() < data.size() );
+  REQUIRE( xz_decompress( compressed ) == data );
+
+}
+
+TEST_CASE("Test shared budget") {
+
+  std::string data;
+  for ( size_t i{}; i < 100000; ++i ) data += emp::to_string( i, ';' );
+
+  dish2::ThreadBudget budget( 3 );
+  const std::string first = dish2::xz_compress_parallel(
+    data, 6, budget, 10000
+  );
+  const std::string second = dish2::xz_compress_parallel(
+    data, 6, budget, 10000
+  );
+  // block boundaries don't depend on the budget
+  REQUIRE( first == dish2::xz_compress_parallel( data, 6, 1, 10000 ) );
+  REQUIRE( xz_decompress( first + second ) == data + data );
+
+}
+
+TEST_CASE("Test appended output") {
+
+  const std::string first = dish2::xz_compress_parallel( "howdy ", 9 );
+  const std::string second = dish2::xz_compress_parallel( "there", 9 );
+  REQUIRE( xz_decompress( first + second ) == "howdy there" );
+
+}
+
+TEST_CASE("Test empty") {
+
+  REQUIRE( xz_decompress( dish2::xz_compress_parallel( "", 9 ) ).empty() );
+
+}
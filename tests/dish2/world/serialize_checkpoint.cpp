@@ -0,0 +1,103 @@
+#include <sstream>
+#include <string>
+#include <utility>
+
+#define CATCH_CONFIG_MAIN
+#define CATCH_CONFIG_DEFAULT_REPORTER "multiprocess"
+#include "Catch/single_include/catch2/catch.hpp"
+#include "cereal/include/cereal/archives/binary.hpp"
+#include "conduit/include/uitsl/debug/MultiprocessReporter.hpp"
+#include "conduit/include/uitsl/mpi/MpiGuard.hpp"
+#include "Empirical/include/emp/base/vector.hpp"
+
+#include "dish2/spec/Spec.hpp"
+#include "dish2/world/ProcWorld.hpp"
+#include "dish2/world/serialize_checkpoint.hpp"
+#include "dish2/world/ThreadWorld.hpp"
+
+const uitsl::MpiGuard guard;
+
+TEST_CASE("Test serialize_checkpoint") {
+
+  auto tw = dish2::ProcWorld<dish2::Spec>{}.MakeThreadWorld(0);
+
+  for (size_t i{}; i < 100; ++i) tw.Update();
+
+  std::stringstream ss;
+  {
+    cereal::BinaryOutputArchive oarchive( ss );
+    dish2::serialize_checkpoint( oarchive, tw );
+  }
+
+  const size_t update = tw.GetUpdate();
+  emp::vector< bool > alive;
+  for (const auto& cell : tw.population) alive.push_back( cell.IsAlive() );
+  const auto first_genome = tw.population.front().genome;
+  const auto first_peripheral = tw.population.front().cardinals.front()
+    .peripheral.readable_state;
+
+  for (size_t i{}; i < 100; ++i) tw.Update();
+
+  {
+    cereal::BinaryInputArchive iarchive( ss );
+    dish2::serialize_checkpoint( iarchive, tw );
+  }
+
+  REQUIRE( tw.GetUpdate() == update );
+  for (size_t i{}; i < tw.GetSize(); ++i) {
+    REQUIRE( tw.GetCell( i ).IsAlive() == alive[i] );
+  }
+  REQUIRE( tw.population.front().genome == first_genome );
+  REQUIRE(
+    tw.population.front().cardinals.front().peripheral.readable_state
+    == first_peripheral
+  );
+
+}
+
+TEST_CASE("Test resumed trajectories") {
+
+  // restored worlds start from fresh cores and empty ducts, so resuming
+  // from the same checkpoint must follow the same trajectory every time
+  auto source = dish2::ProcWorld<dish2::Spec>{}.MakeThreadWorld(0);
+  for (size_t i{}; i < 100; ++i) source.Update();
+
+  std::stringstream ss;
+  {
+    cereal::BinaryOutputArchive oarchive( ss );
+    const auto& const_source = source;
+    dish2::serialize_checkpoint( oarchive, const_source );
+  }
+  const std::string checkpoint = ss.str();
+
+  using trajectory_t = emp::vector< emp::vector< bool > >;
+  const auto resume = [&checkpoint](){
+
+    auto tw = dish2::ProcWorld<dish2::Spec>{}.MakeThreadWorld(0);
+    {
+      std::istringstream is( checkpoint );
+      cereal::BinaryInputArchive iarchive( is );
+      dish2::serialize_checkpoint( iarchive, tw );
+    }
+    // as in dish2::restore_checkpoint
+    dish2::reset_checkpoint_cpus( tw );
+
+    trajectory_t trajectory;
+    for (size_t i{}; i < 50; ++i) {
+      tw.Update();
+      auto& alive = trajectory.emplace_back();
+      for (const auto& cell : tw.population) alive.push_back( cell.IsAlive() );
+    }
+    REQUIRE( tw.GetUpdate() == 150 );
+
+    return std::pair{ trajectory, tw.population.front().genome };
+
+  };
+
+  const auto first = resume();
+  const auto second = resume();
+
+  REQUIRE( first.first == second.first );
+  REQUIRE( first.second == second.second );
+
+}